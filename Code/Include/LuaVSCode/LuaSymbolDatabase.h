@@ -0,0 +1,258 @@
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/string/string_view.h>
+
+//! Binary database of the symbols reflected to Lua, written next to the meta library as symbols.bin.
+//! Every record is fixed size and 4 byte aligned, and names are looked up through precomputed hash tables,
+//! so a tool can map the file into memory and query it through LuaSymbolDatabaseView without parsing it.
+//! Values are stored little endian.
+namespace LuaVSCode::SymbolDatabase
+{
+    constexpr AZ::u32 Magic = 0x4244534c; // "LSDB"
+    //! Bump whenever a record layout changes, readers reject other versions
+    constexpr AZ::u32 Version = 1;
+
+    //! FNV-1a, the hash the lookup tables are built with
+    constexpr AZ::u32 HashName(AZStd::string_view name)
+    {
+        AZ::u32 hash = 0x811c9dc5u;
+        for (char c : name)
+        {
+            hash ^= static_cast<AZ::u8>(c);
+            hash *= 0x01000193u;
+        }
+        return hash;
+    }
+
+    //! Range of bytes in the string blob, strings are not null terminated
+    struct StringRef
+    {
+        AZ::u32 m_offset = 0;
+        AZ::u32 m_size = 0;
+    };
+
+    //! Range of records in another table
+    struct Range
+    {
+        AZ::u32 m_first = 0;
+        AZ::u32 m_count = 0;
+    };
+
+    enum class MethodKind : AZ::u8
+    {
+        Function,
+        Event,
+        Broadcast
+    };
+
+    struct Parameter
+    {
+        StringRef m_type;
+        StringRef m_tooltip;
+    };
+
+    struct Method
+    {
+        StringRef m_name;
+        MethodKind m_kind = MethodKind::Function;
+        //! 0 when only m_debugArgumentInfo is known
+        AZ::u8 m_hasSignature = 0;
+        AZ::u16 m_padding = 0;
+        Range m_parameters;
+        //! empty for void
+        StringRef m_result;
+        StringRef m_debugArgumentInfo;
+    };
+
+    struct Class
+    {
+        StringRef m_name;
+        //! into the property name table
+        Range m_properties;
+        Range m_methods;
+    };
+
+    struct EBus
+    {
+        StringRef m_name;
+        AZ::u8 m_hasSenders = 0;
+        AZ::u8 m_canBroadcast = 0;
+        AZ::u16 m_padding = 0;
+        Range m_senders;
+    };
+
+    //! The tables in the file, in the order they are laid out after the header
+    enum class Table : AZ::u32
+    {
+        Classes,
+        EBuses,
+        Methods,
+        Parameters,
+        PropertyNames,      //!< StringRef per class property
+        GlobalProperties,   //!< StringRef per global property
+        GlobalFunctions,    //!< Method per global function
+        ClassLookup,        //!< hash buckets, see Header
+        EBusLookup,
+        GlobalPropertyLookup,
+        GlobalFunctionLookup,
+        Strings,            //!< byte blob
+        Count
+    };
+
+    constexpr size_t TableCount = static_cast<size_t>(Table::Count);
+
+    //! Location of a table, m_count is in records, or bytes for Strings
+    struct TableRef
+    {
+        AZ::u32 m_offset = 0;
+        AZ::u32 m_count = 0;
+    };
+
+    //! Lookup tables are open addressed with a power of two bucket count and linear probing.
+    //! A bucket holds the index of the record plus one, or 0 when empty.
+    struct Header
+    {
+        AZ::u32 m_magic = Magic;
+        AZ::u32 m_version = Version;
+        //! the meta fingerprint of the reflection the database was built from
+        AZ::u64 m_fingerprint = 0;
+        TableRef m_tables[TableCount];
+    };
+
+    //! Read only view over a database in memory, typically a mapped symbols.bin.
+    //! The memory must outlive the view and every string_view and record returned by it.
+    class LuaSymbolDatabaseView
+    {
+    public:
+        //! Validates the header and table bounds, returns false if data is not a database this version can read
+        bool Open(const void* data, size_t size)
+        {
+            m_data = nullptr;
+            if (!data || size < sizeof(Header) || reinterpret_cast<uintptr_t>(data) % alignof(Header) != 0)
+            {
+                return false;
+            }
+
+            const Header* header = reinterpret_cast<const Header*>(data);
+            if (header->m_magic != Magic || header->m_version != Version)
+            {
+                return false;
+            }
+
+            for (size_t tableIndex = 0; tableIndex < TableCount; ++tableIndex)
+            {
+                const TableRef& table = header->m_tables[tableIndex];
+                const size_t recordSize = GetRecordSize(static_cast<Table>(tableIndex));
+                if (table.m_offset % 4 != 0 || table.m_offset > size || (size - table.m_offset) / recordSize < table.m_count)
+                {
+                    return false;
+                }
+
+                // probing masks the hash with the bucket count
+                const bool isLookup = tableIndex >= static_cast<size_t>(Table::ClassLookup) && tableIndex < static_cast<size_t>(Table::Strings);
+                if (isLookup && (table.m_count & (table.m_count - 1)) != 0)
+                {
+                    return false;
+                }
+            }
+
+            m_data = reinterpret_cast<const AZ::u8*>(data);
+            m_header = header;
+            return true;
+        }
+
+        bool IsOpen() const { return m_data != nullptr; }
+        AZ::u64 GetFingerprint() const { return m_header->m_fingerprint; }
+
+        AZStd::span<const Class> GetClasses() const { return GetTable<Class>(Table::Classes); }
+        AZStd::span<const EBus> GetEBuses() const { return GetTable<EBus>(Table::EBuses); }
+        AZStd::span<const StringRef> GetGlobalProperties() const { return GetTable<StringRef>(Table::GlobalProperties); }
+        AZStd::span<const Method> GetGlobalFunctions() const { return GetTable<Method>(Table::GlobalFunctions); }
+
+        AZStd::span<const StringRef> GetProperties(const Class& luaClass) const { return GetRange<StringRef>(Table::PropertyNames, luaClass.m_properties); }
+        AZStd::span<const Method> GetMethods(const Class& luaClass) const { return GetRange<Method>(Table::Methods, luaClass.m_methods); }
+        AZStd::span<const Method> GetSenders(const EBus& ebus) const { return GetRange<Method>(Table::Methods, ebus.m_senders); }
+        AZStd::span<const Parameter> GetParameters(const Method& method) const { return GetRange<Parameter>(Table::Parameters, method.m_parameters); }
+
+        AZStd::string_view GetString(StringRef string) const
+        {
+            const TableRef& strings = m_header->m_tables[static_cast<size_t>(Table::Strings)];
+            if (string.m_offset > strings.m_count || strings.m_count - string.m_offset < string.m_size)
+            {
+                return {};
+            }
+            return { reinterpret_cast<const char*>(m_data + strings.m_offset + string.m_offset), string.m_size };
+        }
+
+        //! Each returns nullptr when there is no symbol with that name
+        const Class* FindClass(AZStd::string_view name) const { return Find(Table::ClassLookup, GetClasses(), name, [](const Class& record) { return record.m_name; }); }
+        const EBus* FindEBus(AZStd::string_view name) const { return Find(Table::EBusLookup, GetEBuses(), name, [](const EBus& record) { return record.m_name; }); }
+        const StringRef* FindGlobalProperty(AZStd::string_view name) const { return Find(Table::GlobalPropertyLookup, GetGlobalProperties(), name, [](const StringRef& record) { return record; }); }
+        const Method* FindGlobalFunction(AZStd::string_view name) const { return Find(Table::GlobalFunctionLookup, GetGlobalFunctions(), name, [](const Method& record) { return record.m_name; }); }
+
+        static constexpr size_t GetRecordSize(Table table)
+        {
+            switch (table)
+            {
+            case Table::Classes: return sizeof(Class);
+            case Table::EBuses: return sizeof(EBus);
+            case Table::Methods: return sizeof(Method);
+            case Table::Parameters: return sizeof(Parameter);
+            case Table::PropertyNames: return sizeof(StringRef);
+            case Table::GlobalProperties: return sizeof(StringRef);
+            case Table::GlobalFunctions: return sizeof(Method);
+            case Table::Strings: return 1;
+            default: return sizeof(AZ::u32);
+            }
+        }
+
+    private:
+        template<typename T>
+        AZStd::span<const T> GetTable(Table table) const
+        {
+            const TableRef& tableRef = m_header->m_tables[static_cast<size_t>(table)];
+            return { reinterpret_cast<const T*>(m_data + tableRef.m_offset), tableRef.m_count };
+        }
+
+        template<typename T>
+        AZStd::span<const T> GetRange(Table table, Range range) const
+        {
+            AZStd::span<const T> records = GetTable<T>(table);
+            if (range.m_first > records.size() || records.size() - range.m_first < range.m_count)
+            {
+                return {};
+            }
+            return records.subspan(range.m_first, range.m_count);
+        }
+
+        template<typename T, typename GetName>
+        const T* Find(Table lookup, AZStd::span<const T> records, AZStd::string_view name, GetName getName) const
+        {
+            AZStd::span<const AZ::u32> buckets = GetTable<AZ::u32>(lookup);
+            if (buckets.empty())
+            {
+                return nullptr;
+            }
+
+            const size_t mask = buckets.size() - 1;
+            for (size_t bucket = HashName(name) & mask, probe = 0; probe < buckets.size(); bucket = (bucket + 1) & mask, ++probe)
+            {
+                const AZ::u32 entry = buckets[bucket];
+                if (entry == 0)
+                {
+                    return nullptr;
+                }
+                if (entry <= records.size() && GetString(getName(records[entry - 1])) == name)
+                {
+                    return &records[entry - 1];
+                }
+            }
+            return nullptr;
+        }
+
+        const AZ::u8* m_data = nullptr;
+        const Header* m_header = nullptr;
+    };
+} // namespace LuaVSCode::SymbolDatabase
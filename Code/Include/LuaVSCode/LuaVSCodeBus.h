@@ -3,15 +3,56 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace LuaVSCode
 {
+    //! Counters and phase timings of the last meta generation
+    struct LuaMetaGenerationStats
+    {
+        AZ::u64 m_classCount = 0;
+        AZ::u64 m_methodCount = 0;
+        AZ::u64 m_ebusCount = 0;
+        AZ::u64 m_ebusSenderCount = 0;
+        AZ::u64 m_globalPropertyCount = 0;
+        AZ::u64 m_globalFunctionCount = 0;
+
+        AZ::u64 m_filesTotal = 0;
+        AZ::u64 m_filesWritten = 0;
+        //! stale files whose content turned out identical and were left untouched
+        AZ::u64 m_filesUnchanged = 0;
+        AZ::u64 m_bytesWritten = 0;
+        //! file write calls, at most a few per file
+        AZ::u64 m_writeCalls = 0;
+        bool m_restoredFromCache = false;
+
+        // milliseconds per phase, capture runs on the main thread and the rest on jobs
+        float m_captureMs = 0.0f;
+        float m_symbolReporterMs = 0.0f;    //!< LuaSymbolsReporterRequestBus list queries, part of capture
+        float m_reflectionLookupMs = 0.0f;  //!< BehaviorContext class, method and EBus lookups, part of capture
+        float m_hashMs = 0.0f;
+        float m_renderMs = 0.0f;
+        float m_writeMs = 0.0f;
+        float m_generateMs = 0.0f;          //!< everything after capture
+    };
+
     class LuaVSCodeRequests
     {
     public:
         AZ_RTTI(LuaVSCodeRequests, "{1D94E60C-4EAF-4A01-B10B-79C98E3C6A40}");
         virtual ~LuaVSCodeRequests() = default;
-        // Put your public methods here
+
+        //! Returns true once the Lua meta library is up to date with the reflected symbols
+        virtual bool IsMetaGenerationComplete() const = 0;
+
+        //! Returns the progress of the running meta generation in the [0, 1] range
+        virtual float GetMetaGenerationProgress() const = 0;
+
+        //! Blocks the caller until meta generation finishes, returns false if it timed out
+        virtual bool WaitForMetaGeneration(AZ::u32 timeoutMilliseconds) = 0;
+
+        //! Returns the stats of the last finished meta generation
+        virtual LuaMetaGenerationStats GetMetaGenerationStats() const = 0;
     };
     
     class LuaVSCodeBusTraits
@@ -28,4 +69,29 @@ namespace LuaVSCode
     using LuaVSCodeRequestBus = AZ::EBus<LuaVSCodeRequests, LuaVSCodeBusTraits>;
     using LuaVSCodeInterface = AZ::Interface<LuaVSCodeRequests>;
 
+    class LuaVSCodeNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        // meta generation runs on a job thread, its events are queued and delivered on the main thread tick
+        static constexpr bool EnableEventQueue = true;
+        using EventQueueMutexType = AZStd::mutex;
+        //////////////////////////////////////////////////////////////////////////
+
+        virtual ~LuaVSCodeNotifications() = default;
+
+        //! Sent as each meta library section is written, progress is in the [0, 1] range
+        virtual void OnMetaGenerationProgress([[maybe_unused]] float progress) {}
+
+        //! Sent when meta generation finishes, success is false if any meta file could not be written.
+        //! IsMetaGenerationComplete() already returns true when this is delivered.
+        virtual void OnMetaGenerationComplete([[maybe_unused]] bool success) {}
+    };
+
+    using LuaVSCodeNotificationBus = AZ::EBus<LuaVSCodeNotifications>;
+
 } // namespace LuaVSCode
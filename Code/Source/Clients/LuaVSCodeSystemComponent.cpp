@@ -77,8 +77,30 @@ namespace LuaVSCode
         LuaVSCodeRequestBus::Handler::BusDisconnect();
     }
 
+    bool LuaVSCodeSystemComponent::IsMetaGenerationComplete() const
+    {
+        // the meta library is only generated by the editor system component
+        return true;
+    }
+
+    float LuaVSCodeSystemComponent::GetMetaGenerationProgress() const
+    {
+        return 1.0f;
+    }
+
+    bool LuaVSCodeSystemComponent::WaitForMetaGeneration([[maybe_unused]] AZ::u32 timeoutMilliseconds)
+    {
+        return true;
+    }
+
+    LuaMetaGenerationStats LuaVSCodeSystemComponent::GetMetaGenerationStats() const
+    {
+        return {};
+    }
+
     void LuaVSCodeSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        LuaVSCodeNotificationBus::ExecuteQueuedEvents();
     }
 
 } // namespace LuaVSCode
@@ -28,7 +28,10 @@ namespace LuaVSCode
     protected:
         ////////////////////////////////////////////////////////////////////////
         // LuaVSCodeRequestBus interface implementation
-
+        bool IsMetaGenerationComplete() const override;
+        float GetMetaGenerationProgress() const override;
+        bool WaitForMetaGeneration(AZ::u32 timeoutMilliseconds) override;
+        LuaMetaGenerationStats GetMetaGenerationStats() const override;
         ////////////////////////////////////////////////////////////////////////
 
         ////////////////////////////////////////////////////////////////////////
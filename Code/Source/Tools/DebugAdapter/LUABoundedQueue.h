@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/utils.h>
+
+namespace LUADebugger
+{
+    // Fixed size lock-free queue for any number of producers and consumers, after Dmitry Vyukov's bounded MPMC queue.
+    // Each cell carries a sequence number that tells producers and consumers whose turn it is, so a push or pop
+    // is a single compare exchange on the position plus a release store on the cell, and neither side ever waits.
+    template<typename T, size_t Capacity>
+    class LUABoundedQueue
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        LUABoundedQueue()
+        {
+            for (size_t i = 0; i < Capacity; ++i)
+            {
+                m_cells[i].m_sequence.store(i, AZStd::memory_order_relaxed);
+            }
+        }
+
+        LUABoundedQueue(const LUABoundedQueue&) = delete;
+        LUABoundedQueue& operator=(const LUABoundedQueue&) = delete;
+
+        // returns false without taking value when the queue is full
+        bool TryPush(T&& value)
+        {
+            Cell* cell = nullptr;
+            size_t position = m_pushPosition.load(AZStd::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &m_cells[position & Mask];
+                const size_t sequence = cell->m_sequence.load(AZStd::memory_order_acquire);
+                const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position);
+                if (difference == 0)
+                {
+                    if (m_pushPosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // the consumers have not freed this cell yet
+                    return false;
+                }
+                else
+                {
+                    position = m_pushPosition.load(AZStd::memory_order_relaxed);
+                }
+            }
+
+            cell->m_value = AZStd::move(value);
+            cell->m_sequence.store(position + 1, AZStd::memory_order_release);
+            return true;
+        }
+
+        // returns false when the queue is empty
+        bool TryPop(T& value)
+        {
+            Cell* cell = nullptr;
+            size_t position = m_popPosition.load(AZStd::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &m_cells[position & Mask];
+                const size_t sequence = cell->m_sequence.load(AZStd::memory_order_acquire);
+                const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position + 1);
+                if (difference == 0)
+                {
+                    if (m_popPosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    // no producer has finished writing this cell
+                    return false;
+                }
+                else
+                {
+                    position = m_popPosition.load(AZStd::memory_order_relaxed);
+                }
+            }
+
+            value = AZStd::move(cell->m_value);
+            // drop whatever the moved-from value still holds instead of keeping it until the cell is reused
+            cell->m_value = T();
+            cell->m_sequence.store(position + Capacity, AZStd::memory_order_release);
+            return true;
+        }
+
+    private:
+        static constexpr size_t Mask = Capacity - 1;
+        static constexpr size_t CacheLineSize = 64;
+
+        struct Cell
+        {
+            AZStd::atomic<size_t> m_sequence;
+            T m_value;
+        };
+
+        // producers and consumers write different positions, keep them off each other's cache line
+        alignas(CacheLineSize) AZStd::atomic<size_t> m_pushPosition{ 0 };
+        alignas(CacheLineSize) AZStd::atomic<size_t> m_popPosition{ 0 };
+        alignas(CacheLineSize) Cell m_cells[Capacity];
+    };
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LUABreakpoints.h"
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+
+namespace LUADebugger
+{
+    size_t LUABreakpointKeyHash::operator()(const LUABreakpointKey& key) const
+    {
+        size_t hash = AZStd::hash<AZStd::string>{}(key.m_debugName);
+        AZStd::hash_combine(hash, key.m_line);
+        return hash;
+    }
+
+    LUABreakpointTable::Changes LUABreakpointTable::SetLines(const AZStd::string& debugName, const AZStd::vector<int>& lines)
+    {
+        AZStd::vector<int> sortedLines = lines;
+        AZStd::sort(sortedLines.begin(), sortedLines.end());
+        sortedLines.erase(AZStd::unique(sortedLines.begin(), sortedLines.end()), sortedLines.end());
+
+        AZStd::vector<int> previous;
+        if (auto found = m_sources.find(debugName); found != m_sources.end())
+        {
+            previous = AZStd::move(found->second);
+        }
+
+        // both lists are sorted, merge them to find what was added and removed, the rest keep their id and verified state
+        Changes changes;
+        auto previousIt = previous.begin();
+        for (int line : sortedLines)
+        {
+            for (; previousIt != previous.end() && *previousIt < line; ++previousIt)
+            {
+                changes.m_removed.push_back(*previousIt);
+            }
+            if (previousIt != previous.end() && *previousIt == line)
+            {
+                ++previousIt;
+            }
+            else
+            {
+                changes.m_added.push_back(line);
+            }
+        }
+        changes.m_removed.insert(changes.m_removed.end(), previousIt, previous.end());
+
+        LUABreakpointKey key{ debugName, 0 };
+        for (int line : changes.m_removed)
+        {
+            key.m_line = line;
+            m_breakpoints.erase(key);
+        }
+        for (int line : changes.m_added)
+        {
+            key.m_line = line;
+            m_breakpoints.emplace(key, LUABreakpoint{ m_nextId++, false, false });
+        }
+
+        if (sortedLines.empty())
+        {
+            m_sources.erase(debugName);
+        }
+        else
+        {
+            m_sources[debugName] = AZStd::move(sortedLines);
+        }
+        return changes;
+    }
+
+    const LUABreakpoint* LUABreakpointTable::Find(const AZStd::string& debugName, int line) const
+    {
+        auto found = m_breakpoints.find(LUABreakpointKey{ debugName, line });
+        return found != m_breakpoints.end() ? &found->second : nullptr;
+    }
+
+    bool LUABreakpointTable::SetVerified(const AZStd::string& debugName, int line, bool verified)
+    {
+        auto found = m_breakpoints.find(LUABreakpointKey{ debugName, line });
+        if (found == m_breakpoints.end())
+        {
+            return false;
+        }
+        found->second.m_verified = verified;
+        return true;
+    }
+
+    bool LUABreakpointTable::IsVerified(const AZStd::string& debugName, int line) const
+    {
+        const LUABreakpoint* breakpoint = Find(debugName, line);
+        return breakpoint && breakpoint->m_verified;
+    }
+
+    bool LUABreakpointTable::SetReported(const AZStd::string& debugName, int line)
+    {
+        auto found = m_breakpoints.find(LUABreakpointKey{ debugName, line });
+        if (found == m_breakpoints.end())
+        {
+            return false;
+        }
+        found->second.m_reported = true;
+        return true;
+    }
+
+    AZStd::vector<AZStd::pair<LUABreakpointKey, LUABreakpoint>> LUABreakpointTable::ResetVerified()
+    {
+        AZStd::vector<AZStd::pair<LUABreakpointKey, LUABreakpoint>> reset;
+        for (auto& [key, breakpoint] : m_breakpoints)
+        {
+            if (breakpoint.m_verified)
+            {
+                breakpoint.m_verified = false;
+                reset.emplace_back(key, breakpoint);
+            }
+        }
+        return reset;
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/utils.h>
+
+namespace LUADebugger
+{
+    struct LUABreakpoint
+    {
+        // stable for as long as the client keeps a breakpoint on the line, never reused
+        AZ::s64 m_id = 0;
+        // the target acknowledged AddBreakpoint for this line
+        bool m_verified = false;
+        // a setBreakpoints response gave the client the id, later changes are sent as breakpoint events
+        bool m_reported = false;
+    };
+
+    struct LUABreakpointKey
+    {
+        AZStd::string m_debugName;
+        int m_line = 0;
+
+        bool operator==(const LUABreakpointKey& other) const { return m_line == other.m_line && m_debugName == other.m_debugName; }
+    };
+
+    struct LUABreakpointKeyHash
+    {
+        size_t operator()(const LUABreakpointKey& key) const;
+    };
+
+    // The breakpoints the client wants, per source debug name as the target knows it ("@scripts/foo.lua").
+    // DAP always sends every breakpoint of a source, the table turns that into what the target has to change.
+    // Breakpoints are indexed by source and line so a hit maps to its id in constant time.
+    class LUABreakpointTable
+    {
+    public:
+        struct Changes
+        {
+            AZStd::vector<int> m_added;
+            AZStd::vector<int> m_removed;
+
+            bool IsEmpty() const { return m_added.empty() && m_removed.empty(); }
+        };
+
+        // Replaces the breakpoint lines of a source, returns the lines to add on and remove from the target
+        Changes SetLines(const AZStd::string& debugName, const AZStd::vector<int>& lines);
+
+        // nullptr if the source has no breakpoint on that line
+        const LUABreakpoint* Find(const AZStd::string& debugName, int line) const;
+
+        // returns false if the source has no breakpoint on that line
+        bool SetVerified(const AZStd::string& debugName, int line, bool verified);
+        bool IsVerified(const AZStd::string& debugName, int line) const;
+
+        // returns false if the source has no breakpoint on that line
+        bool SetReported(const AZStd::string& debugName, int line);
+
+        // the target forgot every breakpoint, e.g. the debugger detached.
+        // Returns the breakpoints that were verified so the client can be told they no longer are
+        AZStd::vector<AZStd::pair<LUABreakpointKey, LUABreakpoint>> ResetVerified();
+
+        // breakpoint lines of every source in ascending order, to send them all to a newly attached target
+        const AZStd::unordered_map<AZStd::string, AZStd::vector<int>>& GetSources() const { return m_sources; }
+
+    private:
+        AZStd::unordered_map<AZStd::string, AZStd::vector<int>> m_sources;
+        AZStd::unordered_map<LUABreakpointKey, LUABreakpoint, LUABreakpointKeyHash> m_breakpoints;
+        AZ::s64 m_nextId = 1;
+    };
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LUACallstack.h"
+
+#include <AzCore/std/string/conversions.h>
+
+namespace LUADebugger
+{
+    namespace
+    {
+        // Frames look like "[Lua] @scripts/foo.lua (12) : OnActivate(method)", the part in brackets and
+        // the function are optional. Anything else is kept whole as the function name.
+        void ParseFrame(AZStd::string_view line, LUAStackFrame& frame)
+        {
+            if (line.starts_with('['))
+            {
+                const size_t tagEnd = line.find("] ");
+                if (tagEnd != AZStd::string_view::npos)
+                {
+                    line.remove_prefix(tagEnd + 2);
+                }
+            }
+
+            const size_t lineStart = line.find(" (");
+            const size_t lineEnd = lineStart == AZStd::string_view::npos ? lineStart : line.find(')', lineStart);
+            if (lineEnd == AZStd::string_view::npos)
+            {
+                frame.m_function = line;
+                return;
+            }
+
+            const AZStd::string_view lineNumber = line.substr(lineStart + 2, lineEnd - lineStart - 2);
+            frame.m_module = line.substr(0, lineStart);
+            frame.m_line = AZStd::stoi(AZStd::string(lineNumber));
+
+            AZStd::string_view function = line.substr(lineEnd + 1);
+            if (function.starts_with(" : "))
+            {
+                function.remove_prefix(3);
+            }
+            // drop the "(method)" or "(global)" kind after the name
+            if (const size_t kindStart = function.find('('); kindStart != AZStd::string_view::npos)
+            {
+                function = function.substr(0, kindStart);
+            }
+            frame.m_function = function.empty() ? AZStd::string_view("?") : function;
+        }
+    }
+
+    void LUACallstack::Reset()
+    {
+        ++m_epoch;
+        m_hasFrames = false;
+        m_frames.clear();
+    }
+
+    void LUACallstack::SetCallstack(const AZStd::string& callstack)
+    {
+        m_frames.clear();
+        AZStd::string_view remaining = callstack;
+        while (!remaining.empty())
+        {
+            const size_t lineEnd = remaining.find('\n');
+            AZStd::string_view line = remaining.substr(0, lineEnd);
+            remaining = lineEnd == AZStd::string_view::npos ? AZStd::string_view() : remaining.substr(lineEnd + 1);
+            if (line.ends_with('\r'))
+            {
+                line.remove_suffix(1);
+            }
+            if (line.empty())
+            {
+                continue;
+            }
+
+            LUAStackFrame& frame = m_frames.emplace_back();
+            frame.m_id = ((m_epoch & EpochMask) << IndexBits) | static_cast<AZ::s64>(m_frames.size());
+            ParseFrame(line, frame);
+        }
+        m_hasFrames = true;
+    }
+
+    int LUACallstack::GetFrameIndex(AZ::s64 frameId) const
+    {
+        if (((frameId >> IndexBits) & EpochMask) != (m_epoch & EpochMask))
+        {
+            return -1;
+        }
+        const AZ::s64 index = (frameId & IndexMask) - 1;
+        return (index >= 0 && static_cast<size_t>(index) < m_frames.size()) ? static_cast<int>(index) : -1;
+    }
+}
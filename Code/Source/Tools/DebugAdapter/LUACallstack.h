@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace LUADebugger
+{
+    struct LUAStackFrame
+    {
+        AZ::s64 m_id = 0;
+        AZStd::string m_function;
+        // debug name of the script as the target knows it, "@scripts/foo.lua", empty for C functions
+        AZStd::string m_module;
+        int m_line = 0;
+        // absolute path of the module when it is known, filled in by the caller
+        AZStd::string m_sourcePath;
+    };
+
+    // The callstack of the current stop, parsed once from the GetCallstack reply.
+    // Frame ids carry the stop epoch so ids of an older stop are rejected.
+    class LUACallstack
+    {
+    public:
+        // Starts a new stop, waiting for the callstack
+        void Reset();
+
+        // parses the newline separated frames of a ScriptDebugCallStackResult, innermost first
+        void SetCallstack(const AZStd::string& callstack);
+
+        bool HasFrames() const { return m_hasFrames; }
+        AZStd::vector<LUAStackFrame>& GetFrames() { return m_frames; }
+        const AZStd::vector<LUAStackFrame>& GetFrames() const { return m_frames; }
+
+        // index into GetFrames(), or -1 for a stale or unknown frame id
+        int GetFrameIndex(AZ::s64 frameId) const;
+
+    private:
+        static constexpr AZ::s64 IndexBits = 24;
+        static constexpr AZ::s64 IndexMask = (AZ::s64(1) << IndexBits) - 1;
+        static constexpr AZ::s64 EpochMask = 0x7f;
+
+        AZ::s64 m_epoch = 0;
+        bool m_hasFrames = false;
+        AZStd::vector<LUAStackFrame> m_frames;
+    };
+}
@@ -8,6 +8,7 @@
 #include "LUADebugAdapterApplication.h"
 #include "LUADebuggerComponent.h"
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/parallel/lock.h>
 #include <dap/io.h>
 #include <dap/protocol.h>
 #include <dap/session.h>
@@ -22,6 +23,28 @@ namespace LUADebugger
         return s_platform;
     }
 
+    MainLoopWakeup& GetMainLoopWakeup()
+    {
+        static MainLoopWakeup s_mainLoopWakeup;
+        return s_mainLoopWakeup;
+    }
+
+    void MainLoopWakeup::Wake()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_woken = true;
+        }
+        m_condition.notify_one();
+    }
+
+    void MainLoopWakeup::Wait(AZStd::chrono::milliseconds timeout)
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        m_condition.wait_for(lock, timeout, [this]() { return m_woken; });
+        m_woken = false;
+    }
+
     bool Platform::SupportsWaitForDebugger()
     {
         return true;
@@ -88,6 +111,10 @@ namespace LUADebugger
 
     void LUADebugAdapterApplication::RunMainLoop()
     {
+        // RemoteTools does not expose its socket or signal received messages, so it is polled at this interval
+        // while idle. DAP input and LUADebuggerComponent processing messages wake the loop right away.
+        constexpr AZStd::chrono::milliseconds IdlePollInterval{ 5 };
+
         // we have to override this to call TickSystem()
         uint32_t frameCounter = 0;
         while (!m_exitMainLoopRequested)
@@ -96,6 +123,8 @@ namespace LUADebugger
             TickSystem();
             Tick();
             ++frameCounter;
+
+            GetMainLoopWakeup().Wait(IdlePollInterval);
         }
     }
 
@@ -8,6 +8,9 @@
 
 #pragma once
 #include <AzFramework/Application/Application.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace LUADebugger
 {
@@ -22,6 +25,22 @@ namespace LUADebugger
 
     Platform& GetPlatform();
 
+    // The main loop sleeps between ticks until another thread wakes it, e.g. when VS Code sends a request
+    class MainLoopWakeup
+    {
+    public:
+        void Wake();
+        // returns as soon as Wake() is called, or after timeout
+        void Wait(AZStd::chrono::milliseconds timeout);
+
+    private:
+        AZStd::mutex m_mutex;
+        AZStd::condition_variable m_condition;
+        bool m_woken = false;
+    };
+
+    MainLoopWakeup& GetMainLoopWakeup();
+
     class LUADebugAdapterApplication final
         : public AzFramework::Application
     {
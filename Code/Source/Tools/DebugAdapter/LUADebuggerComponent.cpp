@@ -7,17 +7,22 @@
  */
 
 #include "LUADebuggerComponent.h"
+#include "LUADebugAdapterApplication.h"
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Math/Crc.h>
 
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 
 #include <AzFramework/Script/ScriptDebugMsgReflection.h>
 #include <AzFramework/Script/ScriptRemoteDebuggingConstants.h>
@@ -25,6 +30,8 @@
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
 #include <AzCore/Utils/Utils.h>
 
+#include <Tools/LuaMetaGenerator.h>
+
 #include "dap/io.h"
 #include "dap/protocol.h"
 #include "dap/session.h"
@@ -34,6 +41,37 @@
 
 namespace LUADebugger
 {
+    // Wakes the main loop whenever VS Code sends something, so it does not have to spin waiting for requests
+    class WakingReader : public dap::Reader
+    {
+    public:
+        explicit WakingReader(std::shared_ptr<dap::Reader> reader)
+            : m_reader(std::move(reader))
+        {
+        }
+
+        bool isOpen() override
+        {
+            return m_reader->isOpen();
+        }
+
+        void close() override
+        {
+            m_reader->close();
+            GetMainLoopWakeup().Wake();
+        }
+
+        size_t read(void* buffer, size_t n) override
+        {
+            const size_t bytesRead = m_reader->read(buffer, n);
+            GetMainLoopWakeup().Wake();
+            return bytesRead;
+        }
+
+    private:
+        std::shared_ptr<dap::Reader> m_reader;
+    };
+
     // Utility functions
     // Returns true if a valid target was found, in which case the info is returned in targetInfo.
     bool GetDesiredTarget(AzFramework::RemoteToolsEndpointInfo& targetInfo)
@@ -63,14 +101,90 @@ namespace LUADebugger
         return true;
     }
 
+    bool LUADebuggerComponent::PostToTick(TickTask&& task)
+    {
+        if (!m_tickTasks.TryPush(AZStd::move(task)))
+        {
+            return false;
+        }
+        GetMainLoopWakeup().Wake();
+        return true;
+    }
+
+    void LUADebuggerComponent::RunTickTasks()
+    {
+        TickTask task;
+        while (m_tickTasks.TryPop(task))
+        {
+            task();
+        }
+
+        if (m_dapInitializedPending.exchange(false))
+        {
+            OnDapInitialized();
+        }
+        if (m_dapLogClosePending.exchange(false))
+        {
+            CloseDapLog("the error message was dropped, the tick queue was full");
+        }
+    }
+
+    void LUADebuggerComponent::OnDapInitialized()
+    {
+        AZ_TracePrintf("LUADebuggerComponent", "DAP is ready for initialized event");
+        // If the debugger is attached we can signal that we are done initializing 
+        // but usually the "AttachDebugger" ack will happen later and that is when
+        // we signal we are done initializing
+        m_dapInitialized = true;
+        if (m_attached)
+        {
+            m_dapSession->send(dap::InitializedEvent());
+        }
+    }
+
+    void LUADebuggerComponent::CloseDapLog(const AZStd::string& error)
+    {
+        if (m_dapLog)
+        {
+            dap::writef(m_dapLog, "\ndap::Session error: %s\n", error.c_str());
+            m_dapLog->close();
+            // the log spies keep their own reference, the handlers see it is gone
+            m_dapLog = nullptr;
+        }
+    }
+
+    template<typename RequestType, typename Handler>
+    void LUADebuggerComponent::RegisterAsyncTickHandler(Handler handler)
+    {
+        using ResponseType = typename RequestType::Response;
+        using Respond = std::function<void(dap::ResponseOrError<ResponseType>)>;
+
+        // cppdap calls this on its reader thread, the handler runs on the next tick and the response is sent from there
+        m_dapSession->registerHandler([this, handler](const RequestType& request, Respond respond) {
+            if (!PostToTick([handler, request, respond]() { handler(request, respond); }))
+            {
+                respond(dap::Error("The debug adapter is busy, try again"));
+            }
+            });
+    }
+
+    template<typename RequestType, typename Handler>
+    void LUADebuggerComponent::RegisterTickHandler(Handler handler)
+    {
+        using ResponseType = typename RequestType::Response;
+        using Respond = std::function<void(dap::ResponseOrError<ResponseType>)>;
+
+        RegisterAsyncTickHandler<RequestType>([handler](const RequestType& request, const Respond& respond) {
+            respond(handler(request));
+            });
+    }
+
     LUADebuggerComponent::LUADebuggerComponent()
     {
         //Sleep(10*1000);
         m_dapSession = dap::Session::create();
 
         const dap::integer threadId = 100;
-        const dap::integer frameId = 200;
-        const dap::integer variablesReferenceId = 300;
         const dap::integer sourceReferenceId = 400;
 
 #ifdef LOG_TO_FILE
@@ -80,10 +194,12 @@ namespace LUADebugger
         m_dapLog = dap::file(path.c_str());
 #endif
 
-        m_dapSession->onError([&](const char* msg) {
-            if (m_dapLog) {
-                dap::writef(m_dapLog, "\ndap::Session error: %s\n", msg);
-                m_dapLog->close();
+        // cppdap reports errors on its reader thread, the log is closed on the tick like every other write to it
+        m_dapSession->onError([this](const char* msg) {
+            if (!PostToTick([this, error = AZStd::string(msg)]() { CloseDapLog(error); }))
+            {
+                m_dapLogClosePending = true;
+                GetMainLoopWakeup().Wake();
             }
             });
 
@@ -102,21 +218,18 @@ namespace LUADebugger
         // initialize response.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Events_Initialized
         m_dapSession->registerSentHandler(
-            [&](const dap::ResponseOrError<dap::InitializeResponse>&) {
-                AZ_TracePrintf("LUADebuggerComponent", "DAP is ready for initialized event");
-                // If the debugger is attached we can signal that we are done initializing 
-                // but usually the "AttachDebugger" ack will happen later and that is when
-                // we signal we are done initializing
-                m_dapInitialized = true;
-                if (m_attached)
+            [this](const dap::ResponseOrError<dap::InitializeResponse>&) {
+                // the client waits for the initialized event, it cannot be dropped when the tick queue is full
+                if (!PostToTick([this]() { OnDapInitialized(); }))
                 {
-                    m_dapSession->send(dap::InitializedEvent());
+                    m_dapInitializedPending = true;
+                    GetMainLoopWakeup().Wake();
                 }
             });
 
         // The Threads request queries the debugger's list of active threads.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_Threads
-        m_dapSession->registerHandler([&](const dap::ThreadsRequest&) {
+        m_dapSession->registerHandler([threadId](const dap::ThreadsRequest&) {
             dap::ThreadsResponse response;
             dap::Thread thread;
             thread.id = threadId;
@@ -126,78 +239,139 @@ namespace LUADebugger
             });
 
         // The StackTrace request reports the stack frames (call stack) for a given
-        // thread. This example debugger only exposes a single stack frame for the
-        // single thread.
+        // thread. The callstack is requested once per stop and pages are served from it.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_StackTrace
-        m_dapSession->registerHandler(
-            [&](const dap::StackTraceRequest& request)
-            -> dap::ResponseOrError<dap::StackTraceResponse> {
+        RegisterAsyncTickHandler<dap::StackTraceRequest>([this, threadId](const dap::StackTraceRequest& request,
+            const std::function<void(dap::ResponseOrError<dap::StackTraceResponse>)>& respond) {
                 if (request.threadId != threadId) {
-                    return dap::Error("Unknown threadId '%d'", int(request.threadId));
+                    respond(dap::Error("Unknown threadId '%d'", int(request.threadId)));
+                    return;
                 }
 
-                dap::Source source;
-                source.sourceReference = sourceReferenceId;
-                source.name = "HelloDebuggerSource";
-
-                dap::StackFrame frame;
-                frame.line = 0; // debugger.currentLine();
-                frame.column = 1;
-                frame.name = "HelloDebugger";
-                frame.id = frameId;
-                frame.source = source;
+                RequestCallstack([this, request, respond]() {
+                    const auto& frames = m_callstack.GetFrames();
+                    const size_t start = AZStd::min(frames.size(), static_cast<size_t>(AZStd::max<int64_t>(request.startFrame.value(0), 0)));
+                    const size_t levels = static_cast<size_t>(AZStd::max<int64_t>(request.levels.value(0), 0));
+                    const size_t end = levels ? AZStd::min(frames.size(), start + levels) : frames.size();
 
-                dap::StackTraceResponse response;
-                response.stackFrames.push_back(frame);
-                return response;
+                    dap::StackTraceResponse response;
+                    response.totalFrames = static_cast<int64_t>(frames.size());
+                    response.stackFrames.resize(end - start);
+                    for (size_t i = start; i < end; ++i)
+                    {
+                        const LUAStackFrame& luaFrame = frames[i];
+                        dap::StackFrame& frame = response.stackFrames[i - start];
+                        frame.id = luaFrame.m_id;
+                        frame.name = luaFrame.m_function.c_str();
+                        frame.line = luaFrame.m_line;
+                        frame.column = 1;
+                        if (!luaFrame.m_module.empty())
+                        {
+                            dap::Source source;
+                            const AZStd::string_view fileName = AZ::IO::PathView(luaFrame.m_module).Filename().Native();
+                            source.name = std::string(fileName.data(), fileName.size());
+                            if (!luaFrame.m_sourcePath.empty())
+                            {
+                                source.path = luaFrame.m_sourcePath.c_str();
+                            }
+                            else
+                            {
+                                // a script no breakpoint was set in, the client shows the frame without opening it
+                                source.presentationHint = "deemphasize";
+                            }
+                            frame.source = source;
+                        }
+                    }
+                    respond(response);
+                    });
             });
 
         // The Scopes request reports all the scopes of the given stack frame.
-        // This example debugger only exposes a single 'Locals' scope for the single
-        // frame.
+        // Only the locals of the current stop are exposed.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_Scopes
-        m_dapSession->registerHandler([&](const dap::ScopesRequest& request)
+        RegisterTickHandler<dap::ScopesRequest>([this](const dap::ScopesRequest& request)
             -> dap::ResponseOrError<dap::ScopesResponse> {
-                if (request.frameId != frameId) {
+                const int frameIndex = m_callstack.GetFrameIndex(request.frameId);
+                if (frameIndex < 0) {
                     return dap::Error("Unknown frameId '%d'", int(request.frameId));
                 }
 
+                // the target only enumerates the locals of the innermost frame
+                dap::ScopesResponse response;
+                if (frameIndex != 0)
+                {
+                    return response;
+                }
+
                 dap::Scope scope;
                 scope.name = "Locals";
                 scope.presentationHint = "locals";
-                scope.variablesReference = variablesReferenceId;
+                scope.variablesReference = m_variables.GetLocalsReference();
+                if (m_variables.IsComplete())
+                {
+                    scope.namedVariables = static_cast<int64_t>(m_variables.GetLocalCount());
+                }
 
-                dap::ScopesResponse response;
                 response.scopes.push_back(scope);
                 return response;
             });
 
-        // The Variables request reports all the variables for the given scope.
-        // This example debugger only exposes a single 'currentLine' variable for the
-        // single 'Locals' scope.
+        // The Variables request reports the variables of a scope or the children of a table, a page at a time
+        // when the client sends start and count. The locals are answered once the target sent their values or timed out.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_Variables
-        m_dapSession->registerHandler([&](const dap::VariablesRequest& request)
-            -> dap::ResponseOrError<dap::VariablesResponse> {
-                if (request.variablesReference != variablesReferenceId) {
-                    return dap::Error("Unknown variablesReference '%d'",
-                        int(request.variablesReference));
-                }
+        RegisterAsyncTickHandler<dap::VariablesRequest>([this](const dap::VariablesRequest& request,
+            const std::function<void(dap::ResponseOrError<dap::VariablesResponse>)>& respond) {
+                auto respondVariables = [this, request, respond]() {
+                    const AZStd::string filter = request.filter.value("").c_str();
+                    const size_t start = static_cast<size_t>(AZStd::max<int64_t>(request.start.value(0), 0));
+                    const size_t count = static_cast<size_t>(AZStd::max<int64_t>(request.count.value(0), 0));
+
+                    AZStd::vector<LUAVariable> variables;
+                    if (!m_variables.GetVariables(request.variablesReference, filter, start, count, variables))
+                    {
+                        respond(dap::Error("Unknown variablesReference '%d'", int(request.variablesReference)));
+                        return;
+                    }
 
-                dap::Variable currentLineVar;
-                currentLineVar.name = "currentLine";
-                currentLineVar.value = "0"; // std::to_string(debugger.currentLine());
-                currentLineVar.type = "int";
+                    dap::VariablesResponse response;
+                    response.variables.resize(variables.size());
+                    for (size_t i = 0; i < variables.size(); ++i)
+                    {
+                        dap::Variable& variable = response.variables[i];
+                        variable.name = variables[i].m_name.c_str();
+                        variable.value = variables[i].m_value.c_str();
+                        if (!variables[i].m_type.empty())
+                        {
+                            variable.type = variables[i].m_type.c_str();
+                        }
+                        variable.variablesReference = variables[i].m_reference;
+                        if (variables[i].m_namedChildren)
+                        {
+                            variable.namedVariables = static_cast<int64_t>(variables[i].m_namedChildren);
+                        }
+                        if (variables[i].m_indexedChildren)
+                        {
+                            variable.indexedVariables = static_cast<int64_t>(variables[i].m_indexedChildren);
+                        }
+                    }
+                    respond(response);
+                };
 
-                dap::VariablesResponse response;
-                response.variables.push_back(currentLineVar);
-                return response;
+                if (m_variables.IsReady(request.variablesReference))
+                {
+                    respondVariables();
+                }
+                else
+                {
+                    RequestLocals(AZStd::move(respondVariables));
+                }
             });
 
 
         // The Pause request instructs the debugger to pause execution of one or all
         // threads.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_Pause
-        m_dapSession->registerHandler([&](const dap::PauseRequest&) {
+        RegisterTickHandler<dap::PauseRequest>([](const dap::PauseRequest&) {
             //debugger.pause();
             // NOT SUPPORTED
             return dap::PauseResponse();
@@ -206,7 +380,7 @@ namespace LUADebugger
         // The Continue request instructs the debugger to resume execution of one or
         // all threads.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_Continue
-        m_dapSession->registerHandler([&](const dap::ContinueRequest&) {
+        RegisterTickHandler<dap::ContinueRequest>([](const dap::ContinueRequest&) {
             //debugger.run();
             return dap::ContinueResponse();
             });
@@ -214,14 +388,14 @@ namespace LUADebugger
         // The Next request instructs the debugger to single line step for a specific
         // thread.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_Next
-        m_dapSession->registerHandler([&](const dap::NextRequest&) {
+        RegisterTickHandler<dap::NextRequest>([](const dap::NextRequest&) {
             //debugger.stepForward();
             return dap::NextResponse();
             });
 
         // The StepIn request instructs the debugger to step-in for a specific thread.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_StepIn
-        m_dapSession->registerHandler([&](const dap::StepInRequest&) {
+        RegisterTickHandler<dap::StepInRequest>([](const dap::StepInRequest&) {
             // Step-in treated as step-over as there's only one stack frame.
             //debugger.stepForward();
             return dap::StepInResponse();
@@ -230,45 +404,63 @@ namespace LUADebugger
         // The StepOut request instructs the debugger to step-out for a specific
         // thread.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_StepOut
-        m_dapSession->registerHandler([&](const dap::StepOutRequest&) {
+        RegisterTickHandler<dap::StepOutRequest>([](const dap::StepOutRequest&) {
             // Step-out is not supported as there's only one stack frame.
             return dap::StepOutResponse();
             });
 
         // The SetBreakpoints request instructs the debugger to clear and set a number
         // of line breakpoints for a specific source file.
+        // The request holds every breakpoint of the source, only the difference is sent to the target
+        // and the response waits for the target to acknowledge the new ones.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_SetBreakpoints
-        m_dapSession->registerHandler([&](const dap::SetBreakpointsRequest& request) {
-            dap::SetBreakpointsResponse response;
-
-            auto breakpoints = request.breakpoints.value({});
-                //debugger.clearBreakpoints();
-
-            response.breakpoints.resize(breakpoints.size());
-            for (size_t i = 0; i < breakpoints.size(); i++) {
-                //debugger.addBreakpoint(breakpoints[i].line);
-                //response.breakpoints[i].verified = breakpoints[i].line < numSourceLines;
-                CreateBreakpoint(request.source.path.value().c_str(), static_cast<int>(breakpoints[i].line));
-                response.breakpoints[i].id = 0; // TODO assign a unique ID
-                //response.breakpoints[i].verified = breakpoints[i].line < numSourceLines;
-                response.breakpoints[i].verified = true;
+        RegisterAsyncTickHandler<dap::SetBreakpointsRequest>([this](const dap::SetBreakpointsRequest& request,
+            const std::function<void(dap::ResponseOrError<dap::SetBreakpointsResponse>)>& respond) {
+            if (!request.source.path.has_value())
+            {
+                respond(dap::Error("Only breakpoints in source files are supported"));
+                return;
             }
 
-            return response;
+            // Debug name will be the full, absolute path, so convert it to a path relative to the project, gem or engine
+            const AZStd::string debugName = "@" + m_projectRoots.GetRelativePath(request.source.path.value().c_str());
+
+            const auto breakpoints = request.breakpoints.value({});
+            AZStd::vector<int> lines;
+            lines.reserve(breakpoints.size());
+            for (const auto& breakpoint : breakpoints)
+            {
+                lines.push_back(static_cast<int>(breakpoint.line));
+            }
+
+            const LUABreakpointTable::Changes changes = m_breakpoints.SetLines(debugName, lines);
+            // without a target the response goes out right away and the breakpoints are sent when one attaches
+            SendBreakpointChanges(debugName, changes, [this, debugName, lines, respond]() {
+                dap::SetBreakpointsResponse response;
+                response.breakpoints.resize(lines.size());
+                for (size_t i = 0; i < lines.size(); i++) {
+                    const LUABreakpoint* breakpoint = m_breakpoints.Find(debugName, lines[i]);
+                    response.breakpoints[i].id = breakpoint ? breakpoint->m_id : 0;
+                    response.breakpoints[i].line = lines[i];
+                    response.breakpoints[i].verified = breakpoint && breakpoint->m_verified;
+                    m_breakpoints.SetReported(debugName, lines[i]);
+                }
+                respond(response);
+                });
             });
 
         // The SetExceptionBreakpoints request configures the debugger's handling of
         // thrown exceptions.
         // This example debugger does not use any exceptions, so this is a no-op.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_SetExceptionBreakpoints
-        m_dapSession->registerHandler([&](const dap::SetExceptionBreakpointsRequest&) {
+        m_dapSession->registerHandler([](const dap::SetExceptionBreakpointsRequest&) {
             return dap::SetExceptionBreakpointsResponse();
             });
 
         // The Source request retrieves the source code for a given source file.
         // This example debugger only exposes one synthetic source file.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_Source
-        m_dapSession->registerHandler([&](const dap::SourceRequest& request)
+        m_dapSession->registerHandler([sourceReferenceId](const dap::SourceRequest& request)
             -> dap::ResponseOrError<dap::SourceResponse> {
                 if (request.sourceReference != sourceReferenceId) {
                     return dap::Error("Unknown source reference '%d'",
@@ -285,10 +477,10 @@ namespace LUADebugger
         // This example debugger does nothing with this request.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_Launch
         m_dapSession->registerHandler(
-            [&](const dap::LaunchRequest&) { return dap::LaunchResponse(); });
+            [](const dap::LaunchRequest&) { return dap::LaunchResponse(); });
 
         // Handler for disconnect requests
-        m_dapSession->registerHandler([&](const dap::DisconnectRequest& request) {
+        RegisterTickHandler<dap::DisconnectRequest>([this](const dap::DisconnectRequest& request) {
             if (request.terminateDebuggee.value(false)) {
                 //terminate.fire();
 
@@ -304,7 +496,7 @@ namespace LUADebugger
         // requests have been made.
         // This example debugger uses this request to 'start' the debugger.
         // https://microsoft.github.io/debug-adapter-protocol/specification#Requests_ConfigurationDone
-        m_dapSession->registerHandler([&](const dap::ConfigurationDoneRequest&) {
+        RegisterTickHandler<dap::ConfigurationDoneRequest>([this, threadId](const dap::ConfigurationDoneRequest&) {
             //configured.fire();
             dap::ThreadEvent threadStartedEvent;
 
@@ -330,7 +522,7 @@ namespace LUADebugger
         // We now bind the session to stdin and stdout to connect to the client.
         // After the call to bind() we should start receiving requests, starting with
         // the Initialize request.
-        std::shared_ptr<dap::Reader> in = dap::file(stdin, false);
+        std::shared_ptr<dap::Reader> in = std::make_shared<WakingReader>(dap::file(stdin, false));
         std::shared_ptr<dap::Writer> out = dap::file(stdout, false);
 
         if (m_dapLog) {
@@ -380,19 +572,38 @@ namespace LUADebugger
 
     void LUADebuggerComponent::Activate()
     {
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(m_metaOutputPath, MetaOutputKey);
+        }
+
         LUADebuggerRequestBus::Handler::BusConnect();
         AZ::SystemTickBus::Handler::BusConnect();
+        LuaVSCode::LuaVSCodeNotificationBus::Handler::BusConnect();
     }
 
     void LUADebuggerComponent::Deactivate()
     {
+        LuaVSCode::LuaVSCodeNotificationBus::Handler::BusDisconnect();
         AZ::SystemTickBus::Handler::BusDisconnect();
         LUADebuggerRequestBus::Handler::BusDisconnect();
         m_remoteTools = nullptr;
+
+        // waits for a running generation
+        m_metaGenerator.reset();
+        m_attachedSymbols = nullptr;
+        m_generatingSymbols = nullptr;
     }
 
     void LUADebuggerComponent::OnSystemTick()
     {
+        RunTickTasks();
+        if (!m_remoteRequests.IsEmpty())
+        {
+            // replies of a stalled target time out here, the DAP reader thread never waits for them
+            m_remoteRequests.Update(LUARemoteRequests::Clock::now());
+        }
+
         if (!m_remoteTools)
         {
             m_remoteTools = AzFramework::RemoteToolsInterface::Get();
@@ -443,6 +654,8 @@ namespace LUADebugger
             return;
         }
 
+        UpdateRuntimeMeta();
+
         const AzFramework::ReceivedRemoteToolsMessages* messages = m_remoteTools->GetReceivedMessages(AzFramework::LuaToolsKey);
         if (!messages)
         {
@@ -454,11 +667,20 @@ namespace LUADebugger
         {
             if (AzFramework::ScriptDebugAck* ack = azdynamic_cast<AzFramework::ScriptDebugAck*>(msg.get()))
             {
+                if (ack->m_ackCode != AZ_CRC_CE("Ack"))
+                {
+                    // IllegalOperation, AccessDenied and InvalidCmd are the only reply a refused request gets.
+                    // The ack does not carry the argument, the target refuses requests in the order they were sent.
+                    m_remoteRequests.ResolveOldest(ack->m_request, nullptr);
+                }
+
                 if (ack->m_ackCode == AZ_CRC_CE("Ack"))
                 {
                     if (ack->m_request == AZ_CRC_CE("Continue") || ack->m_request == AZ_CRC_CE("StepIn") ||
                         ack->m_request == AZ_CRC_CE("StepOut") || ack->m_request == AZ_CRC_CE("StepOver"))
                     {
+                        // the values of this stop are gone once execution resumes
+                        ResetStop();
                         //LUAEditor::Context_DebuggerManagement::Bus::Broadcast(
                         //    &LUAEditor::Context_DebuggerManagement::OnExecutionResumed);
                     }
@@ -470,10 +692,21 @@ namespace LUADebugger
                         { 
                             m_dapSession->send(dap::InitializedEvent());
                         }
+                        // project, gem or engine folders may have changed between sessions
+                        m_projectRoots.Clear();
+                        SendAllBreakpoints();
+                        EnumRuntimeSymbols();
                     }
                     else if (ack->m_request == AZ_CRC_CE("DetachDebugger"))
                     {
                         m_attached = false;
+                        m_attachedSymbols = nullptr;
+                        // the target drops its breakpoints, nothing else will be replied to
+                        ResetVerifiedBreakpoints();
+                        ResetStop();
+                        // no tombstones, a reattached target would never reply to them and they would swallow
+                        // the replies of the next identical requests
+                        m_remoteRequests.Clear();
                         //LUAEditor::Context_DebuggerManagement::Bus::Broadcast(
                         //    &LUAEditor::Context_DebuggerManagement::OnDebuggerDetached);
                     }
@@ -527,21 +760,27 @@ namespace LUADebugger
                     //    ackBreakpoint->m_moduleName,
                     //    ackBreakpoint->m_line);
                     
-                    dap::ThreadEvent threadStartedEvent;
+                    // ask for the callstack and locals now so they are usually in before the client asks
+                    ResetStop();
+                    RequestCallstack([]() {});
+                    RequestLocals([]() {});
+
                     dap::StoppedEvent stoppedEvent;
                     stoppedEvent.reason = "breakpoint";
                     stoppedEvent.description = "You look awesome";
                     stoppedEvent.threadId = 100; // we just use one thread for now
                     stoppedEvent.text = "Hit breakpoint";
-                    //stoppedEvent.hitBreakpointIds = dap::array<dap::integer>(0);
-                    //auto line = ackBreakpoint->m_line;
-                    //auto sourceName = ackBreakpoint->m_moduleName;
-                    stoppedEvent.hitBreakpointIds = {0}; // TODO store breakpoint IDs above
+                    if (const LUABreakpoint* breakpoint =
+                            m_breakpoints.Find(ackBreakpoint->m_moduleName, static_cast<int>(ackBreakpoint->m_line)))
+                    {
+                        stoppedEvent.hitBreakpointIds = dap::array<dap::integer>{ breakpoint->m_id };
+                    }
 
                     m_dapSession->send(stoppedEvent);
                 }
                 else if (ackBreakpoint->m_id == AZ_CRC_CE("AddBreakpoint"))
                 {
+                    OnBreakpointAdded(ackBreakpoint, ackBreakpoint->m_moduleName, static_cast<int>(ackBreakpoint->m_line));
                     //LUAEditor::Context_DebuggerManagement::Bus::Broadcast(
                     //    &LUAEditor::Context_DebuggerManagement::OnBreakpointAdded,
                     //    ackBreakpoint->m_moduleName,
@@ -567,8 +806,7 @@ namespace LUADebugger
             }
             else if (azrtti_istypeof<AzFramework::ScriptDebugEnumLocalsResult*>(msg.get()))
             {
-                //AzFramework::ScriptDebugEnumLocalsResult* enumLocals =
-                //    azdynamic_cast<AzFramework::ScriptDebugEnumLocalsResult*>(msg.get());
+                m_remoteRequests.Resolve(AZ_CRC_CE("EnumLocals"), {}, msg.get());
                 //LUAEditor::Context_DebuggerManagement::Bus::Broadcast(
                 //    &LUAEditor::Context_DebuggerManagement::OnReceivedLocalVariables, enumLocals->m_names);
             }
@@ -589,8 +827,10 @@ namespace LUADebugger
             }
             else if (azrtti_istypeof<AzFramework::ScriptDebugGetValueResult*>(msg.get()))
             {
-                //AzFramework::ScriptDebugGetValueResult* getValues =
-                //    azdynamic_cast<AzFramework::ScriptDebugGetValueResult*>(msg.get());
+                AzFramework::ScriptDebugGetValueResult* getValues =
+                    azdynamic_cast<AzFramework::ScriptDebugGetValueResult*>(msg.get());
+                const AZStd::string name = getValues->m_value.m_name;
+                m_remoteRequests.Resolve(AZ_CRC_CE("GetValue"), name, msg.get());
                 //LUAEditor::Context_DebuggerManagement::Bus::Broadcast(
                 //    &LUAEditor::Context_DebuggerManagement::OnReceivedValueState, getValues->m_value);
             }
@@ -603,51 +843,124 @@ namespace LUADebugger
             }
             else if (azrtti_istypeof<AzFramework::ScriptDebugCallStackResult*>(msg.get()))
             {
-                AzFramework::ScriptDebugCallStackResult* callStackResult =
-                    azdynamic_cast<AzFramework::ScriptDebugCallStackResult*>(msg.get());
-                AZStd::vector<AZStd::string> callstack;
-                const char* c1 = callStackResult->m_callstack.c_str();
-                for (const char* c2 = c1; *c2; ++c2)
-                {
-                    if (*c2 == '\n')
-                    {
-                        callstack.emplace_back().assign(c1, c2);
-                        c1 = c2 + 1;
-                    }
-                }
-                callstack.emplace_back() = c1;
-                //LUAEditor::Context_DebuggerManagement::Bus::Broadcast(
-                //    &LUAEditor::Context_DebuggerManagement::OnReceivedCallstack, callstack);
+                m_remoteRequests.Resolve(AZ_CRC_CE("GetCallstack"), {}, msg.get());
             }
             else if (azrtti_istypeof<AzFramework::ScriptDebugRegisteredGlobalsResult*>(msg.get()))
             {
-                //AzFramework::ScriptDebugRegisteredGlobalsResult* registeredGlobals =
-                //    azdynamic_cast<AzFramework::ScriptDebugRegisteredGlobalsResult*>(msg.get());
-                //LUAEditor::Context_DebuggerManagement::Bus::Broadcast(
-                //    &LUAEditor::Context_DebuggerManagement::OnReceivedRegisteredGlobals,
-                //    registeredGlobals->m_methods,
-                //    registeredGlobals->m_properties);
+                AzFramework::ScriptDebugRegisteredGlobalsResult* registeredGlobals =
+                    azdynamic_cast<AzFramework::ScriptDebugRegisteredGlobalsResult*>(msg.get());
+                if (m_attachedSymbols)
+                {
+                    m_attachedSymbols->m_globalMethods = AZStd::move(registeredGlobals->m_methods);
+                    m_attachedSymbols->m_globalProperties = AZStd::move(registeredGlobals->m_properties);
+                    m_attachedSymbols->m_hasGlobals = true;
+                }
             }
             else if (azrtti_istypeof<AzFramework::ScriptDebugRegisteredClassesResult*>(msg.get()))
             {
-                //AzFramework::ScriptDebugRegisteredClassesResult* registeredClasses =
-                //    azdynamic_cast<AzFramework::ScriptDebugRegisteredClassesResult*>(msg.get());
-                //LUAEditor::Context_DebuggerManagement::Bus::Broadcast(
-                //    &LUAEditor::Context_DebuggerManagement::OnReceivedRegisteredClasses, registeredClasses->m_classes);
+                AzFramework::ScriptDebugRegisteredClassesResult* registeredClasses =
+                    azdynamic_cast<AzFramework::ScriptDebugRegisteredClassesResult*>(msg.get());
+                if (m_attachedSymbols)
+                {
+                    m_attachedSymbols->m_classes = AZStd::move(registeredClasses->m_classes);
+                    m_attachedSymbols->m_hasClasses = true;
+                }
             }
             else if (azrtti_istypeof<AzFramework::ScriptDebugRegisteredEBusesResult*>(msg.get()))
             {
-                //AzFramework::ScriptDebugRegisteredEBusesResult* registeredEBuses =
-                //    azdynamic_cast<AzFramework::ScriptDebugRegisteredEBusesResult*>(msg.get());
-                //LUAEditor::Context_DebuggerManagement::Bus::Broadcast(
-                //    &LUAEditor::Context_DebuggerManagement::OnReceivedRegisteredEBuses, registeredEBuses->m_ebusList);
+                AzFramework::ScriptDebugRegisteredEBusesResult* registeredEBuses =
+                    azdynamic_cast<AzFramework::ScriptDebugRegisteredEBusesResult*>(msg.get());
+                if (m_attachedSymbols)
+                {
+                    m_attachedSymbols->m_ebuses = AZStd::move(registeredEBuses->m_ebusList);
+                    m_attachedSymbols->m_hasEBuses = true;
+                }
             }
             else
             {
                 AZ_Assert(false, "We received a message of an unrecognized class type!");
             }
         }
+        const bool receivedMessages = !messages->empty();
         m_remoteTools->ClearReceivedMessages(AzFramework::LuaToolsKey);
+
+        // more messages usually follow, e.g. the three replies of EnumRuntimeSymbols(), so tick again right away
+        if (receivedMessages)
+        {
+            GetMainLoopWakeup().Wake();
+        }
+    }
+
+    void LUADebuggerComponent::EnumRuntimeSymbols()
+    {
+        if (m_metaOutputPath.empty() || m_attachedContextName.empty())
+        {
+            return;
+        }
+
+        AzFramework::RemoteToolsEndpointInfo targetInfo;
+        if (!m_remoteTools || !GetDesiredTarget(targetInfo))
+        {
+            return;
+        }
+
+        // the target may have been restarted with other gems since the last attach, so always ask again
+        m_attachedSymbols = &m_runtimeSymbols.Get(targetInfo.GetPersistentId(), m_attachedContextName);
+        m_attachedSymbols->ClearReplies();
+        EnumRegisteredClasses(m_attachedContextName.c_str());
+        EnumRegisteredEBuses(m_attachedContextName.c_str());
+        EnumRegisteredGlobals(m_attachedContextName.c_str());
+    }
+
+    void LUADebuggerComponent::UpdateRuntimeMeta()
+    {
+        // the generator reports progress and completion through queued events
+        LuaVSCode::LuaVSCodeNotificationBus::ExecuteQueuedEvents();
+
+        if (!m_attachedSymbols || !m_attachedSymbols->HasAllReplies() || m_generatingSymbols)
+        {
+            return;
+        }
+        // OnMetaGenerationComplete is broadcast, the editor's own generator finishing clears m_generatingSymbols too,
+        // so the job is checked before SetSymbols() replaces the snapshot it still reads
+        if (m_metaGenerator && !m_metaGenerator->IsComplete())
+        {
+            return;
+        }
+
+        const AZ::u64 hash = m_attachedSymbols->GetHash();
+        if (m_attachedSymbols->m_generated && m_attachedSymbols->m_generatedHash == hash)
+        {
+            AZ_TracePrintf("LUA Debug", "Meta for script context '%s' is up to date\n", m_attachedContextName.c_str());
+            m_attachedSymbols->ClearReplies();
+            return;
+        }
+
+        if (!m_metaGenerator)
+        {
+            LuaVSCode::LuaMetaGeneratorSettings settings;
+            settings.Load();
+            m_metaGenerator = AZStd::make_unique<LuaVSCode::LuaMetaGenerator>();
+            m_metaGenerator->SetOutputPath(m_metaOutputPath.c_str());
+            m_metaGenerator->SetSettings(settings);
+        }
+
+        AZ_TracePrintf("LUA Debug", "Generating meta for script context '%s' in '%s'\n", m_attachedContextName.c_str(), m_metaOutputPath.c_str());
+        m_metaGenerator->SetSymbols(m_attachedSymbols->CreateMetaSymbols());
+        m_attachedSymbols->ClearReplies();
+        m_generatingSymbols = m_attachedSymbols;
+        m_generatingHash = hash;
+        m_metaGenerator->GenerateAsync();
+    }
+
+    void LUADebuggerComponent::OnMetaGenerationComplete(bool success)
+    {
+        if (m_generatingSymbols && success)
+        {
+            m_generatingSymbols->m_generated = true;
+            m_generatingSymbols->m_generatedHash = m_generatingHash;
+        }
+        m_generatingSymbols = nullptr;
     }
 
     void LUADebuggerComponent::EnumerateContexts()
@@ -666,6 +979,7 @@ namespace LUADebugger
         AZ_TracePrintf("LUA Debug", "LUADebuggerComponent::AttachDebugger( %s )\n", scriptContextName);
 
         AZ_Assert(scriptContextName, "You need to supply a valid script context name to attach to!");
+        m_attachedContextName = scriptContextName;
         AzFramework::RemoteToolsEndpointInfo targetInfo;
         if (m_remoteTools && GetDesiredTarget(targetInfo))
         {
@@ -711,80 +1025,12 @@ namespace LUADebugger
         }
     }
 
-    AZ::IO::FixedMaxPath ScanUpRootLocator(AZ::IO::FixedMaxPath path, AZStd::string_view rootFileToLocate)
-    {
-        AZ::IO::FixedMaxPath rootCandidate{ path };
-
-        bool rootPathVisited = false;
-        do
-        {
-            if (AZ::IO::SystemFile::Exists((rootCandidate / rootFileToLocate).c_str()))
-            {
-                return rootCandidate;
-            }
-
-            // Note for posix filesystems the parent directory of '/' is '/' and for windows
-            // the parent directory of 'C:\\' is 'C:\\'
-
-            // Validate that the parent directory isn't itself, that would imply
-            // that it is the filesystem root path
-            AZ::IO::PathView parentPath = rootCandidate.ParentPath();
-            rootPathVisited = (rootCandidate == parentPath);
-            // Recurse upwards one directory
-            rootCandidate = AZStd::move(parentPath);
-
-        } while (!rootPathVisited);
-
-        return {};
-    }
-
-    AZStd::string GetRelativePath(const AZStd::string& absolutePath)
-    {
-        // First try the project
-        AZ::IO::FixedMaxPath filePath{ absolutePath };
-        AZStd::string relativePath = filePath.AsPosix().c_str();
-        auto root = ScanUpRootLocator(filePath, "project.json");
-        if (root.empty())
-        {
-            // try a gem 
-            root = ScanUpRootLocator(filePath, "gem.json");
-            if (!root.empty())
-            {
-                // should be in an Assets folder if in a gem
-                root /= "Assets";
-            }
-        }
-        if (root.empty())
-        {
-            root = ScanUpRootLocator(filePath, "engine.json");
-            
-            // could be Assets/Engine or Assets/Editor??
-            if (!root.empty())
-            {
-                root /= "Assets";
-                root /= "Engine";
-            }
-        }
-
-        if (filePath.IsRelativeTo(root))
-        {
-            auto rootPathString = AZStd::string_view(root.AsPosix().c_str());
-            if (relativePath.size() > rootPathString.size() + 1)
-            {
-                // add one to account for the 'slash'
-                relativePath = relativePath.substr(rootPathString.size() + 1, relativePath.size() - rootPathString.size());
-            }
-        }
-
-        return relativePath;
-    }
-
     void LUADebuggerComponent::CreateBreakpoint(const AZStd::string& debugName, int lineNumber)
     {
         // register a breakpoint.
 
         // Debug name will be the full, absolute path, so convert it to a path relative to the project, gem or engine
-        AZStd::string relativePath = GetRelativePath(debugName);
+        AZStd::string relativePath = m_projectRoots.GetRelativePath(debugName);
         //AzToolsFramework::AssetSystemRequestBus::Broadcast(
         //    &AzToolsFramework::AssetSystemRequestBus::Events::GetRelativeProductPathFromFullSourceOrProductPath, debugName, relativePath);
         relativePath = "@" + relativePath;
@@ -804,7 +1050,7 @@ namespace LUADebugger
         // remove a breakpoint.
 
         // Debug name will be the full, absolute path, so convert it to a path relative to the project, gem or engine
-        AZStd::string relativePath = GetRelativePath(debugName);
+        AZStd::string relativePath = m_projectRoots.GetRelativePath(debugName);
         // TODO connect to the asset processor if available to get this info
         //AzToolsFramework::AssetSystemRequestBus::Broadcast(
         //    &AzToolsFramework::AssetSystemRequestBus::Events::GetRelativeProductPathFromFullSourceOrProductPath, debugName, relativePath);
@@ -820,6 +1066,207 @@ namespace LUADebugger
         }
     }
 
+    AZStd::string LUADebuggerComponent::GetBreakpointArgument(const AZStd::string& debugName, int line)
+    {
+        return AZStd::string::format("%s:%d", debugName.c_str(), line);
+    }
+
+    void LUADebuggerComponent::SendBreakpointChanges(
+        const AZStd::string& debugName, const LUABreakpointTable::Changes& changes, AZStd::function<void()> acknowledged)
+    {
+        AzFramework::RemoteToolsEndpointInfo targetInfo;
+        if (!m_remoteTools || !m_attached || !GetDesiredTarget(targetInfo))
+        {
+            acknowledged();
+            return;
+        }
+
+        // removals first so a line that moved never has two breakpoints on the target
+        for (int line : changes.m_removed)
+        {
+            m_remoteTools->SendRemoteToolsMessage(targetInfo, AzFramework::ScriptDebugBreakpointRequest(AZ_CRC_CE("RemoveBreakpoint"), debugName.c_str(), static_cast<AZ::u32>(line)));
+        }
+        if (changes.m_added.empty())
+        {
+            acknowledged();
+            return;
+        }
+
+        auto remaining = AZStd::make_shared<size_t>(changes.m_added.size());
+        for (int line : changes.m_added)
+        {
+            // always sent, a line removed and added again while its first ack is in flight must still end up on the target
+            m_remoteRequests.Track(AZ_CRC_CE("AddBreakpoint"), GetBreakpointArgument(debugName, line), RemoteReplyTimeout,
+                [remaining, acknowledged](AzFramework::RemoteToolsMessage*) {
+                    if (--*remaining == 0)
+                    {
+                        acknowledged();
+                    }
+                });
+            m_remoteTools->SendRemoteToolsMessage(targetInfo, AzFramework::ScriptDebugBreakpointRequest(AZ_CRC_CE("AddBreakpoint"), debugName.c_str(), static_cast<AZ::u32>(line)));
+        }
+    }
+
+    void LUADebuggerComponent::SendAllBreakpoints()
+    {
+        ResetVerifiedBreakpoints();
+        for (const auto& [debugName, lines] : m_breakpoints.GetSources())
+        {
+            LUABreakpointTable::Changes changes;
+            changes.m_added = lines;
+            SendBreakpointChanges(debugName, changes, []() {});
+        }
+    }
+
+    void LUADebuggerComponent::OnBreakpointAdded(AzFramework::RemoteToolsMessage* ack, const AZStd::string& debugName, int line)
+    {
+        // a breakpoint removed while its AddBreakpoint was in flight is not in the table anymore.
+        // Only an ack after the response went out (a timed out one, or a target that attached later) is sent as an event.
+        const LUABreakpoint* breakpoint = m_breakpoints.Find(debugName, line);
+        if (breakpoint && !breakpoint->m_verified)
+        {
+            m_breakpoints.SetVerified(debugName, line, true);
+            SendBreakpointChanged(debugName, line, *breakpoint);
+        }
+        m_remoteRequests.Resolve(AZ_CRC_CE("AddBreakpoint"), GetBreakpointArgument(debugName, line), ack);
+    }
+
+    void LUADebuggerComponent::ResetVerifiedBreakpoints()
+    {
+        for (const auto& [key, breakpoint] : m_breakpoints.ResetVerified())
+        {
+            SendBreakpointChanged(key.m_debugName, key.m_line, breakpoint);
+        }
+    }
+
+    void LUADebuggerComponent::SendBreakpointChanged(const AZStd::string& debugName, int line, const LUABreakpoint& breakpoint)
+    {
+        // until its setBreakpoints response goes out the client does not know the id, the response carries the state
+        if (!m_dapSession || !m_dapInitialized || !breakpoint.m_reported)
+        {
+            return;
+        }
+
+        dap::BreakpointEvent event;
+        event.reason = "changed";
+        event.breakpoint.id = static_cast<int64_t>(breakpoint.m_id);
+        event.breakpoint.line = line;
+        event.breakpoint.verified = m_breakpoints.IsVerified(debugName, line);
+
+        // debug names are "@" followed by the path relative to the project, gem or engine
+        const AZStd::string sourcePath = m_projectRoots.GetAbsolutePath(AZStd::string_view(debugName).substr(1));
+        if (!sourcePath.empty())
+        {
+            dap::Source source;
+            source.path = sourcePath.c_str();
+            event.breakpoint.source = source;
+        }
+        m_dapSession->send(event);
+    }
+
+    void LUADebuggerComponent::SendTrackedRequest(AZ::Crc32 request, const AZStd::string& argument, LUARemoteRequests::Continuation&& continuation)
+    {
+        AzFramework::RemoteToolsEndpointInfo targetInfo;
+        if (!m_remoteTools || !GetDesiredTarget(targetInfo))
+        {
+            continuation(nullptr);
+            return;
+        }
+
+        if (m_remoteRequests.Track(request, argument, RemoteReplyTimeout, AZStd::move(continuation)))
+        {
+            m_remoteTools->SendRemoteToolsMessage(targetInfo, AzFramework::ScriptDebugRequest(request, argument.c_str()));
+        }
+    }
+
+    void LUADebuggerComponent::RequestCallstack(AZStd::function<void()> done)
+    {
+        if (m_callstack.HasFrames())
+        {
+            done();
+            return;
+        }
+
+        SendTrackedRequest(AZ_CRC_CE("GetCallstack"), {}, [this, done](AzFramework::RemoteToolsMessage* reply) {
+            auto callStackResult = azdynamic_cast<AzFramework::ScriptDebugCallStackResult*>(reply);
+            // every continuation of the request gets the reply, only the first one parses it
+            if (callStackResult && !m_callstack.HasFrames())
+            {
+                m_callstack.SetCallstack(callStackResult->m_callstack);
+                for (LUAStackFrame& frame : m_callstack.GetFrames())
+                {
+                    // modules are "@" followed by the path GetRelativePath() made for a breakpoint
+                    if (frame.m_module.starts_with('@'))
+                    {
+                        frame.m_sourcePath = m_projectRoots.GetAbsolutePath(AZStd::string_view(frame.m_module).substr(1));
+                    }
+                }
+            }
+            done();
+            });
+    }
+
+    void LUADebuggerComponent::RequestLocals(AZStd::function<void()> done)
+    {
+        if (m_variables.IsComplete())
+        {
+            done();
+            return;
+        }
+
+        if (!m_variables.HasLocals())
+        {
+            SendTrackedRequest(AZ_CRC_CE("EnumLocals"), {}, [this, done](AzFramework::RemoteToolsMessage* reply) {
+                auto enumLocals = azdynamic_cast<AzFramework::ScriptDebugEnumLocalsResult*>(reply);
+                if (!enumLocals)
+                {
+                    done();
+                    return;
+                }
+                if (!m_variables.HasLocals())
+                {
+                    m_variables.SetLocals(enumLocals->m_names);
+                }
+                RequestLocals(done);
+                });
+            return;
+        }
+
+        // the target sends each value with all of its table entries, requests go out back to back
+        // and the ones already in flight are joined
+        const AZStd::vector<AZStd::string> missingValues = m_variables.GetMissingValues();
+        if (missingValues.empty())
+        {
+            done();
+            return;
+        }
+        auto remaining = AZStd::make_shared<size_t>(missingValues.size());
+        for (const AZStd::string& name : missingValues)
+        {
+            SendTrackedRequest(AZ_CRC_CE("GetValue"), name, [this, remaining, done](AzFramework::RemoteToolsMessage* reply) {
+                auto getValue = azdynamic_cast<AzFramework::ScriptDebugGetValueResult*>(reply);
+                if (getValue && !m_variables.HasValue(getValue->m_value.m_name))
+                {
+                    m_variables.SetValue(AZStd::move(getValue->m_value));
+                }
+                if (--*remaining == 0)
+                {
+                    done();
+                }
+                });
+        }
+    }
+
+    void LUADebuggerComponent::ResetStop()
+    {
+        // requests of this stop complete with the replies that are in before those are dropped
+        m_remoteRequests.Cancel(AZ_CRC_CE("GetCallstack"));
+        m_remoteRequests.Cancel(AZ_CRC_CE("EnumLocals"));
+        m_remoteRequests.Cancel(AZ_CRC_CE("GetValue"));
+        m_callstack.Reset();
+        m_variables.Reset();
+    }
+
     void LUADebuggerComponent::DebugRunStepOver()
     {
         AzFramework::RemoteToolsEndpointInfo targetInfo;
@@ -9,10 +9,21 @@
 #ifndef LUADEBUGGER_COMPONENT_H
 #define LUADEBUGGER_COMPONENT_H
 
+#include "LUABoundedQueue.h"
+#include "LUABreakpoints.h"
+#include "LUACallstack.h"
 #include "LUADebuggerBus.h"
+#include "LUAProjectRoots.h"
+#include "LUARemoteRequests.h"
+#include "LUARuntimeSymbols.h"
+#include "LUAVariables.h"
 #include <AzFramework/Network/IRemoteTools.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <LuaVSCode/LuaVSCodeBus.h>
 
 #pragma once
 
@@ -22,16 +33,25 @@ namespace dap
     class Writer;
 }
 
+namespace LuaVSCode
+{
+    class LuaMetaGenerator;
+}
+
 namespace LUADebugger
 {
     class LUADebuggerComponent
         : public AZ::Component
         , public LUADebugger::LUADebuggerRequests::Bus::Handler
         , public AZ::SystemTickBus::Handler
+        , public LuaVSCode::LuaVSCodeNotificationBus::Handler
     {
     public:
         AZ_COMPONENT(LUADebuggerComponent, "{DF0E8693-691C-4B79-8B80-F8964C8E63AD}");
 
+        // Folder the meta library of the attached script context is written to, set by --meta-output
+        static constexpr const char* MetaOutputKey = "/O3DE/LuaVSCode/DebugAdapter/MetaOutput";
+
         LUADebuggerComponent();
         virtual ~LUADebuggerComponent();
 
@@ -53,6 +73,11 @@ namespace LUADebugger
         //! @{
         void OnSystemTick() override;
         //! @}
+
+        //! LuaVSCode::LuaVSCodeNotificationBus::Handler overrides.
+        //! @{
+        void OnMetaGenerationComplete(bool success) override;
+        //! @}
         //
         //////////////////////////////////////////////////////////////////////////
         // Enumerate script contexts on the target
@@ -101,6 +126,49 @@ namespace LUADebugger
         //////////////////////////////////////////////////////////////////////////
 
      private:
+        using TickTask = AZStd::function<void()>;
+
+        // Queues task for the next tick, returns false when the queue is full
+        bool PostToTick(TickTask&& task);
+        void RunTickTasks();
+        // Initialize was answered, sends the initialized event once a target is attached
+        void OnDapInitialized();
+        // Writes the session error and closes the log, the tick handlers write to it
+        void CloseDapLog(const AZStd::string& error);
+        // Registers a DAP request handler that runs on the tick thread instead of cppdap's reader thread
+        template<typename RequestType, typename Handler>
+        void RegisterTickHandler(Handler handler);
+        // Same for handlers that respond later through the callback they are given
+        template<typename RequestType, typename Handler>
+        void RegisterAsyncTickHandler(Handler handler);
+
+        // Sends the breakpoint changes of one source to the target back to back, acknowledged runs once the
+        // target acknowledged or timed out every added line, right away if there is no target
+        void SendBreakpointChanges(
+            const AZStd::string& debugName, const LUABreakpointTable::Changes& changes, AZStd::function<void()> acknowledged);
+        // Sends every breakpoint in the table to a target that just attached
+        void SendAllBreakpoints();
+        void OnBreakpointAdded(AzFramework::RemoteToolsMessage* ack, const AZStd::string& debugName, int line);
+        // Marks every breakpoint unverified and tells the client about the ones that were verified
+        void ResetVerifiedBreakpoints();
+        // Sends a "changed" BreakpointEvent, the client only learns about verification from setBreakpoints otherwise
+        void SendBreakpointChanged(const AZStd::string& debugName, int line, const LUABreakpoint& breakpoint);
+        static AZStd::string GetBreakpointArgument(const AZStd::string& debugName, int line);
+
+        // Sends a ScriptDebugRequest unless an identical one is in flight, continuation gets its reply,
+        // nullptr when there is no target or it timed out
+        void SendTrackedRequest(AZ::Crc32 request, const AZStd::string& argument, LUARemoteRequests::Continuation&& continuation);
+        // done runs once the callstack or the locals of the stop are in, or could not be had
+        void RequestCallstack(AZStd::function<void()> done);
+        void RequestLocals(AZStd::function<void()> done);
+        // Forgets the callstack and variables of the last stop, execution resumed or stopped again
+        void ResetStop();
+
+        // Ask the attached context for everything it has registered, the replies generate its meta library
+        void EnumRuntimeSymbols();
+        // Generates the meta library once all replies for the attached context are in and it changed
+        void UpdateRuntimeMeta();
+
         AzFramework::IRemoteTools* m_remoteTools = nullptr;
         std::unique_ptr<dap::Session> m_dapSession = nullptr;
         std::shared_ptr<dap::Writer> m_dapLog = nullptr;
@@ -110,6 +178,32 @@ namespace LUADebugger
         bool m_attached = false;
         bool m_dapInitialized = false;
         AZStd::vector<AZStd::string> m_contextNames;
+
+        // meta generation for the attached context, off unless a meta output folder is set
+        AZStd::string m_metaOutputPath;
+        AZStd::string m_attachedContextName;
+        LUARuntimeSymbolCache m_runtimeSymbols;
+        // breakpoint paths are converted on the tick thread only
+        LUAProjectRoots m_projectRoots;
+        LUARuntimeSymbols* m_attachedSymbols = nullptr;
+        LUARuntimeSymbols* m_generatingSymbols = nullptr;
+        AZ::u64 m_generatingHash = 0;
+        AZStd::unique_ptr<LuaVSCode::LuaMetaGenerator> m_metaGenerator;
+
+        LUABreakpointTable m_breakpoints;
+        LUACallstack m_callstack;
+        LUAVariableStore m_variables;
+
+        // requests to the target waiting for their reply, responses to the client complete from their continuations
+        static constexpr AZStd::chrono::milliseconds RemoteReplyTimeout{ 2000 };
+        LUARemoteRequests m_remoteRequests;
+
+        // DAP requests waiting for the tick thread, so component state is only ever touched there
+        static constexpr size_t TickTaskCapacity = 256;
+        LUABoundedQueue<TickTask, TickTaskCapacity> m_tickTasks;
+        // set by the reader thread when its task did not fit in m_tickTasks, these must not be lost
+        AZStd::atomic_bool m_dapInitializedPending{ false };
+        AZStd::atomic_bool m_dapLogClosePending{ false };
     };
 };
 
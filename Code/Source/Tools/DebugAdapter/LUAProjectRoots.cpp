@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LUAProjectRoots.h"
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace LUADebugger
+{
+    namespace
+    {
+        constexpr const char* MarkerFiles[] = { "project.json", "gem.json", "engine.json" };
+    }
+
+    void LUAProjectRoots::Clear()
+    {
+        m_directories.clear();
+    }
+
+    const LUAProjectRoots::DirectoryRoots& LUAProjectRoots::GetDirectoryRoots(const AZStd::string& directory)
+    {
+        if (auto found = m_directories.find(directory); found != m_directories.end())
+        {
+            return found->second;
+        }
+
+        // walk up until a known directory or the filesystem root, then fill in the unknown ones top down
+        // so each of them only probes its own marker files
+        AZStd::vector<AZStd::string> unknownDirectories;
+        const DirectoryRoots* parentRoots = nullptr;
+        AZ::IO::FixedMaxPath candidate{ directory, AZ::IO::PosixPathSeparator };
+        for (;;)
+        {
+            AZStd::string candidateString{ candidate.Native() };
+            if (auto found = m_directories.find(candidateString); found != m_directories.end())
+            {
+                parentRoots = &found->second;
+                break;
+            }
+            unknownDirectories.push_back(AZStd::move(candidateString));
+
+            // Note for posix filesystems the parent directory of '/' is '/' and for windows
+            // the parent directory of 'C:\\' is 'C:\\'
+            AZ::IO::PathView parentPath = candidate.ParentPath();
+            if (parentPath.empty() || candidate == parentPath)
+            {
+                break;
+            }
+            candidate = parentPath;
+        }
+
+        DirectoryRoots roots = parentRoots ? *parentRoots : DirectoryRoots{};
+        const DirectoryRoots* directoryRoots = parentRoots;
+        for (auto unknown = unknownDirectories.rbegin(); unknown != unknownDirectories.rend(); ++unknown)
+        {
+            for (int marker = 0; marker < MarkerCount; ++marker)
+            {
+                AZ::IO::FixedMaxPath markerPath{ *unknown, AZ::IO::PosixPathSeparator };
+                markerPath /= MarkerFiles[marker];
+                if (AZ::IO::SystemFile::Exists(markerPath.c_str()))
+                {
+                    roots.m_roots[marker] = *unknown;
+                }
+            }
+            directoryRoots = &m_directories.emplace(*unknown, roots).first->second;
+        }
+        return *directoryRoots;
+    }
+
+    AZStd::string LUAProjectRoots::GetRelativePath(const AZStd::string& absolutePath)
+    {
+        AZ::IO::FixedMaxPath filePath{ absolutePath };
+        AZStd::string relativePath = filePath.AsPosix().c_str();
+        AZ::IO::FixedMaxPath directory{ relativePath, AZ::IO::PosixPathSeparator };
+        directory = directory.ParentPath();
+        if (directory.empty())
+        {
+            return relativePath;
+        }
+
+        const DirectoryRoots& roots = GetDirectoryRoots(AZStd::string{ directory.Native() });
+
+        // First try the project
+        AZ::IO::FixedMaxPath root{ roots.m_roots[Project], AZ::IO::PosixPathSeparator };
+        if (root.empty() && !roots.m_roots[Gem].empty())
+        {
+            // should be in an Assets folder if in a gem
+            root = AZ::IO::FixedMaxPath{ roots.m_roots[Gem], AZ::IO::PosixPathSeparator };
+            root /= "Assets";
+        }
+        if (root.empty() && !roots.m_roots[Engine].empty())
+        {
+            // could be Assets/Engine or Assets/Editor??
+            root = AZ::IO::FixedMaxPath{ roots.m_roots[Engine], AZ::IO::PosixPathSeparator };
+            root /= "Assets";
+            root /= "Engine";
+        }
+
+        AZ::IO::FixedMaxPath posixFilePath{ relativePath, AZ::IO::PosixPathSeparator };
+        if (!root.empty() && posixFilePath.IsRelativeTo(root))
+        {
+            auto rootPathString = AZStd::string_view(root.Native());
+            if (relativePath.size() > rootPathString.size() + 1)
+            {
+                // add one to account for the 'slash'
+                relativePath = relativePath.substr(rootPathString.size() + 1, relativePath.size() - rootPathString.size());
+            }
+        }
+
+        m_absolutePaths[relativePath] = absolutePath;
+        return relativePath;
+    }
+
+    AZStd::string LUAProjectRoots::GetAbsolutePath(AZStd::string_view relativePath) const
+    {
+        auto found = m_absolutePaths.find(AZStd::string(relativePath));
+        return found != m_absolutePaths.end() ? found->second : AZStd::string();
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+
+namespace LUADebugger
+{
+    // Converts absolute script paths to the path relative to their project, gem or engine assets, the way the
+    // target names its script assets. Which marker file each directory is under is remembered, including the
+    // directories with no marker at all, so once a folder is known converting a path in it touches no files.
+    class LUAProjectRoots
+    {
+    public:
+        AZStd::string GetRelativePath(const AZStd::string& absolutePath);
+
+        // the absolute path a relative path was made from by GetRelativePath(), empty if it never was
+        AZStd::string GetAbsolutePath(AZStd::string_view relativePath) const;
+
+        // forget every directory, for when marker files may have been added or removed
+        void Clear();
+
+    private:
+        enum Marker
+        {
+            Project,
+            Gem,
+            Engine,
+            MarkerCount
+        };
+
+        // nearest folder at or above a directory holding each marker, empty if there is none
+        struct DirectoryRoots
+        {
+            AZStd::string m_roots[MarkerCount];
+        };
+
+        const DirectoryRoots& GetDirectoryRoots(const AZStd::string& directory);
+
+        // keyed by posix directory path
+        AZStd::unordered_map<AZStd::string, DirectoryRoots> m_directories;
+        // relative to absolute path, not a file system cache so Clear() keeps it
+        AZStd::unordered_map<AZStd::string, AZStd::string> m_absolutePaths;
+    };
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LUARemoteRequests.h"
+
+#include <AzCore/std/algorithm.h>
+
+namespace LUADebugger
+{
+    AZStd::string LUARemoteRequests::MakeKey(AZ::Crc32 request, AZStd::string_view argument)
+    {
+        return AZStd::string::format("%08x/%.*s", static_cast<AZ::u32>(request), AZ_STRING_ARG(argument));
+    }
+
+    bool LUARemoteRequests::Track(
+        AZ::Crc32 request, AZStd::string_view argument, AZStd::chrono::milliseconds timeout, Continuation&& continuation)
+    {
+        AZStd::string key = MakeKey(request, argument);
+        AZStd::deque<InFlight>& inFlight = m_requests[key];
+        if (!inFlight.empty() && !inFlight.back().m_cancelled)
+        {
+            inFlight.back().m_continuations.push_back(AZStd::move(continuation));
+            return false;
+        }
+
+        m_sent[request].push_back(AZStd::move(key));
+        InFlight& added = inFlight.emplace_back();
+        added.m_request = request;
+        added.m_deadline = Clock::now() + timeout;
+        added.m_expiry = added.m_deadline + TombstoneLifetime;
+        added.m_continuations.push_back(AZStd::move(continuation));
+        return true;
+    }
+
+    bool LUARemoteRequests::Resolve(AZ::Crc32 request, AZStd::string_view argument, AzFramework::RemoteToolsMessage* reply)
+    {
+        return ResolveKey(MakeKey(request, argument), reply);
+    }
+
+    bool LUARemoteRequests::ResolveOldest(AZ::Crc32 request, AzFramework::RemoteToolsMessage* reply)
+    {
+        auto sent = m_sent.find(request);
+        if (sent == m_sent.end())
+        {
+            return false;
+        }
+        // copied, resolving removes it from m_sent
+        const AZStd::string key = sent->second.front();
+        return ResolveKey(key, reply);
+    }
+
+    bool LUARemoteRequests::ResolveKey(const AZStd::string& key, AzFramework::RemoteToolsMessage* reply)
+    {
+        auto found = m_requests.find(key);
+        if (found == m_requests.end())
+        {
+            return false;
+        }
+
+        // continuations may track new requests, take them out before running them
+        InFlight resolved = AZStd::move(found->second.front());
+        found->second.pop_front();
+        if (found->second.empty())
+        {
+            m_requests.erase(found);
+        }
+        RemoveSent(resolved.m_request, key);
+
+        for (Continuation& continuation : resolved.m_continuations)
+        {
+            continuation(reply);
+        }
+        return true;
+    }
+
+    void LUARemoteRequests::Update(Clock::time_point now)
+    {
+        AZStd::vector<Continuation> timedOut;
+        for (auto it = m_requests.begin(); it != m_requests.end();)
+        {
+            AZStd::deque<InFlight>& inFlight = it->second;
+            for (InFlight& request : inFlight)
+            {
+                if (!request.m_cancelled && now >= request.m_deadline)
+                {
+                    for (Continuation& continuation : request.m_continuations)
+                    {
+                        timedOut.push_back(AZStd::move(continuation));
+                    }
+                    request.m_continuations.clear();
+                    request.m_cancelled = true;
+                }
+            }
+            // requests expire in the order they were sent, so the expired tombstones are at the front
+            while (!inFlight.empty() && inFlight.front().m_cancelled && now >= inFlight.front().m_expiry)
+            {
+                RemoveSent(inFlight.front().m_request, it->first);
+                inFlight.pop_front();
+            }
+            it = inFlight.empty() ? m_requests.erase(it) : AZStd::next(it);
+        }
+
+        for (Continuation& continuation : timedOut)
+        {
+            continuation(nullptr);
+        }
+    }
+
+    void LUARemoteRequests::CancelAll()
+    {
+        CancelMatching({});
+    }
+
+    void LUARemoteRequests::Cancel(AZ::Crc32 request)
+    {
+        CancelMatching(MakeKey(request, {}));
+    }
+
+    void LUARemoteRequests::Clear()
+    {
+        // continuations may track new requests, take everything out before running them
+        AZStd::unordered_map<AZStd::string, AZStd::deque<InFlight>> cleared = AZStd::move(m_requests);
+        m_requests.clear();
+        m_sent.clear();
+
+        for (auto& [key, inFlight] : cleared)
+        {
+            for (InFlight& request : inFlight)
+            {
+                for (Continuation& continuation : request.m_continuations)
+                {
+                    continuation(nullptr);
+                }
+            }
+        }
+    }
+
+    void LUARemoteRequests::RemoveSent(AZ::Crc32 request, const AZStd::string& key)
+    {
+        auto sent = m_sent.find(request);
+        if (sent == m_sent.end())
+        {
+            return;
+        }
+        auto oldest = AZStd::find(sent->second.begin(), sent->second.end(), key);
+        if (oldest != sent->second.end())
+        {
+            sent->second.erase(oldest);
+        }
+        if (sent->second.empty())
+        {
+            m_sent.erase(sent);
+        }
+    }
+
+    void LUARemoteRequests::CancelMatching(AZStd::string_view keyPrefix)
+    {
+        AZStd::vector<Continuation> cancelled;
+        for (auto& [key, inFlight] : m_requests)
+        {
+            if (!AZStd::string_view(key).starts_with(keyPrefix))
+            {
+                continue;
+            }
+            for (InFlight& request : inFlight)
+            {
+                for (Continuation& continuation : request.m_continuations)
+                {
+                    cancelled.push_back(AZStd::move(continuation));
+                }
+                request.m_continuations.clear();
+                request.m_cancelled = true;
+            }
+        }
+
+        for (Continuation& continuation : cancelled)
+        {
+            continuation(nullptr);
+        }
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Network/IRemoteTools.h>
+
+namespace LUADebugger
+{
+    // Requests sent to the target whose reply has not arrived yet. Replies carry no request id, so a request is
+    // identified by its name and argument ("GetValue" and the variable name) and replies to the same request
+    // arrive in the order the requests were sent.
+    // Everything runs on the tick thread, a continuation is the future of a request and runs once with the reply,
+    // or with nullptr when the request timed out or was cancelled, nothing ever waits for the target.
+    class LUARemoteRequests
+    {
+    public:
+        // the first continuation of a request may move data out of the reply, later ones see what is left
+        using Continuation = AZStd::function<void(AzFramework::RemoteToolsMessage* reply)>;
+        using Clock = AZStd::chrono::steady_clock;
+
+        // Adds a continuation to the request, returns true if it has to be sent and false if it joined
+        // an identical request that is already in flight
+        bool Track(AZ::Crc32 request, AZStd::string_view argument, AZStd::chrono::milliseconds timeout, Continuation&& continuation);
+
+        // Runs the continuations of the oldest request the reply belongs to, returns false if none was in flight
+        bool Resolve(AZ::Crc32 request, AZStd::string_view argument, AzFramework::RemoteToolsMessage* reply);
+
+        // Same for the oldest request with this name whatever its argument, for acks that only carry the name
+        // such as a refused request. Returns false if none was in flight.
+        bool ResolveOldest(AZ::Crc32 request, AzFramework::RemoteToolsMessage* reply);
+
+        // Times out the requests whose deadline passed. A timed out request stays in flight, cancelled, until its
+        // reply or TombstoneLifetime later, a late reply would otherwise resolve the next identical request.
+        void Update(Clock::time_point now);
+
+        // Runs every continuation with nullptr, e.g. execution resumed and the replies would be stale.
+        // Requests stay in flight until their reply or expiry so the late replies are dropped.
+        void CancelAll();
+        // Same for the requests with this name only
+        void Cancel(AZ::Crc32 request);
+
+        // Runs every continuation with nullptr and forgets every request, e.g. the target detached and will
+        // never reply to them
+        void Clear();
+
+        bool IsEmpty() const { return m_requests.empty(); }
+
+        // how long past its deadline a request is kept to drop its late reply
+        static constexpr AZStd::chrono::milliseconds TombstoneLifetime{ 30000 };
+
+    private:
+        struct InFlight
+        {
+            AZ::Crc32 m_request;
+            Clock::time_point m_deadline;
+            Clock::time_point m_expiry;
+            AZStd::vector<Continuation> m_continuations;
+            bool m_cancelled = false;
+        };
+
+        static AZStd::string MakeKey(AZ::Crc32 request, AZStd::string_view argument);
+        // cancels the requests whose key starts with keyPrefix
+        void CancelMatching(AZStd::string_view keyPrefix);
+        bool ResolveKey(const AZStd::string& key, AzFramework::RemoteToolsMessage* reply);
+        // removes the oldest entry of key from m_sent
+        void RemoveSent(AZ::Crc32 request, const AZStd::string& key);
+
+        // oldest first per request
+        AZStd::unordered_map<AZStd::string, AZStd::deque<InFlight>> m_requests;
+        // keys of the requests in m_requests per name in the order they were sent, cancelled ones included
+        AZStd::unordered_map<AZ::Crc32, AZStd::deque<AZStd::string>> m_sent;
+    };
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LUARuntimeSymbols.h"
+
+#include <AzCore/std/hash.h>
+
+namespace LUADebugger
+{
+    void LUARuntimeSymbols::ClearReplies()
+    {
+        m_classes.clear();
+        m_ebuses.clear();
+        m_globalMethods.clear();
+        m_globalProperties.clear();
+        m_hasClasses = false;
+        m_hasEBuses = false;
+        m_hasGlobals = false;
+    }
+
+    AZ::u64 LUARuntimeSymbols::GetHash() const
+    {
+        // only compared within one adapter session, the generator fingerprint covers later runs
+        size_t hash = 0;
+        for (const auto& luaClass : m_classes)
+        {
+            AZStd::hash_combine(hash, luaClass.m_name);
+            for (const auto& method : luaClass.m_methods)
+            {
+                AZStd::hash_combine(hash, method.m_name, method.m_info);
+            }
+            for (const auto& luaProperty : luaClass.m_properties)
+            {
+                AZStd::hash_combine(hash, luaProperty.m_name);
+            }
+        }
+        for (const auto& ebus : m_ebuses)
+        {
+            AZStd::hash_combine(hash, ebus.m_name, ebus.m_canBroadcast);
+            for (const auto& event : ebus.m_events)
+            {
+                AZStd::hash_combine(hash, event.m_name, event.m_info);
+            }
+        }
+        for (const auto& method : m_globalMethods)
+        {
+            AZStd::hash_combine(hash, method.m_name, method.m_info);
+        }
+        for (const auto& globalProperty : m_globalProperties)
+        {
+            AZStd::hash_combine(hash, globalProperty.m_name);
+        }
+        return hash;
+    }
+
+    LuaVSCode::LuaMetaSymbols LUARuntimeSymbols::CreateMetaSymbols() const
+    {
+        using namespace LuaVSCode;
+
+        // the remote context only reports names and debug argument info, so methods have no typed signature
+        LuaMetaSymbols symbols;
+        symbols.m_classes.reserve(m_classes.size());
+        for (const auto& luaClass : m_classes)
+        {
+            LuaMetaClass& metaClass = symbols.m_classes.emplace_back();
+            metaClass.m_name = luaClass.m_name;
+            metaClass.m_typeId = luaClass.m_typeId;
+
+            metaClass.m_properties.reserve(luaClass.m_properties.size());
+            for (const auto& luaProperty : luaClass.m_properties)
+            {
+                metaClass.m_properties.push_back(luaProperty.m_name);
+            }
+
+            metaClass.m_methods.reserve(luaClass.m_methods.size());
+            for (const auto& luaMethod : luaClass.m_methods)
+            {
+                if (luaMethod.m_name == "AcquireOwnership" || luaMethod.m_name == "ReleaseOwnership")
+                {
+                    continue;
+                }
+                LuaMetaMethod& method = metaClass.m_methods.emplace_back();
+                method.m_name = luaMethod.m_name;
+                method.m_debugArgumentInfo = luaMethod.m_info;
+            }
+        }
+
+        symbols.m_ebuses.reserve(m_ebuses.size());
+        for (const auto& ebus : m_ebuses)
+        {
+            LuaMetaEBus& metaEBus = symbols.m_ebuses.emplace_back();
+            metaEBus.m_name = ebus.m_name;
+            metaEBus.m_hasSenders = !ebus.m_events.empty();
+            metaEBus.m_canBroadcast = ebus.m_canBroadcast;
+
+            metaEBus.m_senders.reserve(ebus.m_events.size() * (ebus.m_canBroadcast ? 2 : 1));
+            for (const auto& event : ebus.m_events)
+            {
+                LuaMetaMethod& sender = metaEBus.m_senders.emplace_back();
+                sender.m_name = event.m_name;
+                sender.m_kind = LuaMetaMethodKind::Event;
+                sender.m_debugArgumentInfo = event.m_info;
+                if (ebus.m_canBroadcast)
+                {
+                    LuaMetaMethod& broadcast = metaEBus.m_senders.emplace_back(sender);
+                    broadcast.m_kind = LuaMetaMethodKind::Broadcast;
+                }
+            }
+        }
+
+        symbols.m_globalProperties.reserve(m_globalProperties.size());
+        for (const auto& globalProperty : m_globalProperties)
+        {
+            symbols.m_globalProperties.push_back(globalProperty.m_name);
+        }
+
+        symbols.m_globalFunctions.reserve(m_globalMethods.size());
+        for (const auto& globalMethod : m_globalMethods)
+        {
+            LuaMetaMethod& method = symbols.m_globalFunctions.emplace_back();
+            method.m_name = globalMethod.m_name;
+            method.m_debugArgumentInfo = globalMethod.m_info;
+        }
+        return symbols;
+    }
+
+    LUARuntimeSymbols& LUARuntimeSymbolCache::Get(AZ::u32 targetId, AZStd::string_view contextName)
+    {
+        return m_symbols[AZStd::string::format("%08x/%.*s", targetId, AZ_STRING_ARG(contextName))];
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Script/ScriptDebugMsgReflection.h>
+#include <Tools/LuaMetaSymbols.h>
+
+namespace LUADebugger
+{
+    // What a script context on the target reported through EnumRegisteredClasses, EnumRegisteredEBuses
+    // and EnumRegisteredGlobals. A launcher can load different gems than the Editor, so this is the only
+    // exact description of what its scripts can call.
+    struct LUARuntimeSymbols
+    {
+        AzFramework::ScriptUserClassList m_classes;
+        AzFramework::ScriptUserEBusList m_ebuses;
+        AzFramework::ScriptUserMethodList m_globalMethods;
+        AzFramework::ScriptUserPropertyList m_globalProperties;
+
+        bool m_hasClasses = false;
+        bool m_hasEBuses = false;
+        bool m_hasGlobals = false;
+
+        // hash of the replies the meta library was last generated from
+        bool m_generated = false;
+        AZ::u64 m_generatedHash = 0;
+
+        bool HasAllReplies() const { return m_hasClasses && m_hasEBuses && m_hasGlobals; }
+
+        // forget the replies before enumerating again, the generated hash is kept
+        void ClearReplies();
+
+        // equal hashes generate the same meta library
+        AZ::u64 GetHash() const;
+
+        // the replies as a snapshot for LuaVSCode::LuaMetaGenerator
+        LuaVSCode::LuaMetaSymbols CreateMetaSymbols() const;
+    };
+
+    // Runtime symbols per target and script context
+    class LUARuntimeSymbolCache
+    {
+    public:
+        LUARuntimeSymbols& Get(AZ::u32 targetId, AZStd::string_view contextName);
+
+    private:
+        AZStd::unordered_map<AZStd::string, LUARuntimeSymbols> m_symbols;
+    };
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LUAVariables.h"
+
+#include <AzCore/std/algorithm.h>
+
+namespace LUADebugger
+{
+    namespace
+    {
+        // names of the LUA_T* values DebugValue::m_type holds
+        const char* GetTypeName(char type)
+        {
+            static constexpr const char* TypeNames[] = {
+                "nil", "boolean", "lightuserdata", "number", "string", "table", "function", "userdata", "thread"
+            };
+            return (type >= 0 && type < static_cast<char>(AZ_ARRAY_SIZE(TypeNames))) ? TypeNames[static_cast<size_t>(type)] : "unknown";
+        }
+
+        constexpr char TableType = 5;
+    }
+
+    void LUAVariableStore::Reset()
+    {
+        ++m_epoch;
+        m_hasLocals = false;
+        m_localNames.clear();
+        m_values.clear();
+        m_tables.clear();
+        m_tableReferences.clear();
+    }
+
+    void LUAVariableStore::SetLocals(const AZStd::vector<AZStd::string>& names)
+    {
+        m_localNames = names;
+        m_hasLocals = true;
+    }
+
+    void LUAVariableStore::SetValue(AZ::ScriptContextDebug::DebugValue&& value)
+    {
+        if (AZStd::find(m_localNames.begin(), m_localNames.end(), value.m_name) == m_localNames.end())
+        {
+            return;
+        }
+        // a value that is already referenced keeps its tree so existing references stay valid
+        m_values.emplace(value.m_name, AZStd::move(value));
+    }
+
+    AZStd::vector<AZStd::string> LUAVariableStore::GetMissingValues() const
+    {
+        AZStd::vector<AZStd::string> missingValues;
+        for (const AZStd::string& name : m_localNames)
+        {
+            if (!HasValue(name))
+            {
+                missingValues.push_back(name);
+            }
+        }
+        return missingValues;
+    }
+
+    bool LUAVariableStore::IsComplete() const
+    {
+        return m_hasLocals && m_values.size() == m_localNames.size();
+    }
+
+    bool LUAVariableStore::IsReady(AZ::s64 reference) const
+    {
+        return GetIndex(reference) != LocalsIndex || IsComplete();
+    }
+
+    AZ::s64 LUAVariableStore::GetLocalsReference() const
+    {
+        return MakeReference(LocalsIndex);
+    }
+
+    AZ::s64 LUAVariableStore::MakeReference(AZ::s64 index) const
+    {
+        // the epoch in the high bits tells references of an older stop apart
+        return ((m_epoch & EpochMask) << IndexBits) | index;
+    }
+
+    AZ::s64 LUAVariableStore::GetIndex(AZ::s64 reference) const
+    {
+        if (((reference >> IndexBits) & EpochMask) != (m_epoch & EpochMask))
+        {
+            return -1;
+        }
+        const AZ::s64 index = reference & IndexMask;
+        if (index == LocalsIndex || (index > LocalsIndex && static_cast<size_t>(index - LocalsIndex - 1) < m_tables.size()))
+        {
+            return index;
+        }
+        return -1;
+    }
+
+    LUAVariable LUAVariableStore::MakeVariable(const AZ::ScriptContextDebug::DebugValue& value)
+    {
+        LUAVariable variable;
+        variable.m_name = value.m_name;
+        variable.m_type = GetTypeName(value.m_type);
+        if (value.m_type == TableType)
+        {
+            variable.m_value = AZStd::string::format("table[%zu]", value.m_elements.size());
+        }
+        else
+        {
+            variable.m_value = value.m_value;
+        }
+
+        if (!value.m_elements.empty())
+        {
+            auto [found, inserted] = m_tableReferences.emplace(&value, 0);
+            if (inserted && static_cast<AZ::s64>(m_tables.size()) + LocalsIndex + 1 <= IndexMask)
+            {
+                m_tables.push_back(&value);
+                found->second = MakeReference(LocalsIndex + static_cast<AZ::s64>(m_tables.size()));
+            }
+            variable.m_reference = found->second;
+            if (value.m_elements.size() > PageSize)
+            {
+                variable.m_indexedChildren = value.m_elements.size();
+            }
+            else
+            {
+                variable.m_namedChildren = value.m_elements.size();
+            }
+        }
+        return variable;
+    }
+
+    bool LUAVariableStore::GetVariables(
+        AZ::s64 reference, const AZStd::string& filter, size_t start, size_t count, AZStd::vector<LUAVariable>& variables)
+    {
+        const AZ::s64 index = GetIndex(reference);
+        if (index < 0)
+        {
+            return false;
+        }
+
+        if (index == LocalsIndex)
+        {
+            const size_t end = count ? AZStd::min(m_localNames.size(), start + count) : m_localNames.size();
+            for (size_t i = start; i < end; ++i)
+            {
+                auto found = m_values.find(m_localNames[i]);
+                if (found != m_values.end())
+                {
+                    variables.push_back(MakeVariable(found->second));
+                }
+                else
+                {
+                    LUAVariable& variable = variables.emplace_back();
+                    variable.m_name = m_localNames[i];
+                    variable.m_value = "<not available>";
+                }
+            }
+            return true;
+        }
+
+        // small tables only have named children and large ones only indexed, see MakeVariable()
+        const AZ::ScriptContextDebug::DebugValue& table = *m_tables[static_cast<size_t>(index - LocalsIndex - 1)];
+        const bool isIndexed = table.m_elements.size() > PageSize;
+        if ((filter == "indexed" && !isIndexed) || (filter == "named" && isIndexed))
+        {
+            return true;
+        }
+
+        const size_t end = count ? AZStd::min(table.m_elements.size(), start + count) : table.m_elements.size();
+        for (size_t i = start; i < end; ++i)
+        {
+            variables.push_back(MakeVariable(table.m_elements[i]));
+        }
+        return true;
+    }
+}
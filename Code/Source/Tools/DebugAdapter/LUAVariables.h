@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Script/ScriptContextDebug.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace LUADebugger
+{
+    // One row of a DAP variables response
+    struct LUAVariable
+    {
+        AZStd::string m_name;
+        AZStd::string m_value;
+        AZStd::string m_type;
+        // non zero for tables, the client asks for the children with it
+        AZ::s64 m_reference = 0;
+        // tables larger than a page report indexed children so the client asks for them a page at a time
+        size_t m_namedChildren = 0;
+        size_t m_indexedChildren = 0;
+    };
+
+    // The locals of the current stop and the DebugValue trees the target sent for them. References are only
+    // handed out for the tables the client was shown and rows are only built for the page it asks for,
+    // so a table with thousands of entries costs one page of DAP messages.
+    // Everything is forgotten when execution resumes, references of an older stop are rejected.
+    class LUAVariableStore
+    {
+    public:
+        static constexpr size_t PageSize = 100;
+
+        // Starts a new stop, waiting for the names of the locals
+        void Reset();
+
+        void SetLocals(const AZStd::vector<AZStd::string>& names);
+        // a GetValue reply, values for names that are not locals of this stop are dropped
+        void SetValue(AZ::ScriptContextDebug::DebugValue&& value);
+
+        bool HasLocals() const { return m_hasLocals; }
+        bool HasValue(const AZStd::string& name) const { return m_values.find(name) != m_values.end(); }
+        // locals whose value has not arrived yet
+        AZStd::vector<AZStd::string> GetMissingValues() const;
+
+        // true once the names and a value for each of them arrived
+        bool IsComplete() const;
+        // true when a Variables request for this reference can be answered right away
+        bool IsReady(AZ::s64 reference) const;
+
+        AZ::s64 GetLocalsReference() const;
+        size_t GetLocalCount() const { return m_localNames.size(); }
+
+        // filter is the DAP variables filter, "indexed", "named" or empty for all
+        // returns false for an unknown or stale reference
+        bool GetVariables(AZ::s64 reference, const AZStd::string& filter, size_t start, size_t count, AZStd::vector<LUAVariable>& variables);
+
+    private:
+        // 0 is no reference, 1 the locals of the stop, the rest index m_tables
+        static constexpr AZ::s64 LocalsIndex = 1;
+        static constexpr AZ::s64 IndexBits = 24;
+        static constexpr AZ::s64 IndexMask = (AZ::s64(1) << IndexBits) - 1;
+        static constexpr AZ::s64 EpochMask = 0x7f;
+
+        AZ::s64 MakeReference(AZ::s64 index) const;
+        // index into m_tables, or -1 for a stale or unknown reference
+        AZ::s64 GetIndex(AZ::s64 reference) const;
+
+        LUAVariable MakeVariable(const AZ::ScriptContextDebug::DebugValue& value);
+
+        AZ::s64 m_epoch = 0;
+        bool m_hasLocals = false;
+        AZStd::vector<AZStd::string> m_localNames;
+        // node based so the trees stay where they are while m_tables points into them
+        AZStd::unordered_map<AZStd::string, AZ::ScriptContextDebug::DebugValue> m_values;
+        // tables the client was given a reference to, a reference is LocalsIndex + 1 + position
+        AZStd::vector<const AZ::ScriptContextDebug::DebugValue*> m_tables;
+        AZStd::unordered_map<const AZ::ScriptContextDebug::DebugValue*, AZ::s64> m_tableReferences;
+    };
+}
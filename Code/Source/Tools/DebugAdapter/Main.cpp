@@ -10,7 +10,9 @@
 #include <sstream>
 #include <memory>
 #include "AzCore/Platform.h"
+#include "AzCore/Settings/SettingsRegistry.h"
 #include "LUADebugAdapterApplication.h"
+#include "LUADebuggerComponent.h"
 
 //! display proper usage of the application
 void usage([[maybe_unused]] LUADebugger::Platform& platform)
@@ -25,11 +27,12 @@ void usage([[maybe_unused]] LUADebugger::Platform& platform)
         "A LUA debug adapter for VS Code and O3DE.\n"
         "\n"
         "Usage:\n"
-        "   LUAVisualCodeDebugAdapter.exe [--wait-for-debugger] [--quiet]\n"
+        "   LUAVisualCodeDebugAdapter.exe [--wait-for-debugger] [--quiet] [--meta-output=<folder>]\n"
         "\n"
         "Options:\n"
         "   --wait-for-debugger: wait for a debugger to attach to process (on supported platforms)\n"
         "   --verbose: output debug info\n"
+        "   --meta-output=<folder>: write the Lua meta library of the attached script context to <folder>\n"
         "\n"
         "Exit Codes:\n"
         "   0 - success\n"
@@ -47,6 +50,8 @@ int main([[maybe_unused]]int argc, [[maybe_unused]]char* argv[])
 
     bool waitForDebugger = false;
     bool verbose = false;
+    const char* metaOutput = nullptr;
+    constexpr const char metaOutputOption[] = "--meta-output=";
     for (int i = 0; i < argc; i++)
     {
         if (strcmp(argv[i], "--wait-for-debugger") == 0)
@@ -57,6 +62,10 @@ int main([[maybe_unused]]int argc, [[maybe_unused]]char* argv[])
         {
             verbose = true;
         }
+        else if (strncmp(argv[i], metaOutputOption, sizeof(metaOutputOption) - 1) == 0)
+        {
+            metaOutput = argv[i] + sizeof(metaOutputOption) - 1;
+        }
         else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-?") == 0)
         {
             usage(platform);
@@ -82,6 +91,10 @@ int main([[maybe_unused]]int argc, [[maybe_unused]]char* argv[])
         AZ::Debug::Trace::Instance().SetLogLevel(AZ::Debug::LogLevel::Disabled);
     }
     LUADebugger::LUADebugAdapterApplication app(&argc, &argv);
+    if (metaOutput && *metaOutput)
+    {
+        AZ::SettingsRegistry::Get()->Set(LUADebugger::LUADebuggerComponent::MetaOutputKey, metaOutput);
+    }
     app.Start({}, {});
     app.RunMainLoop();
     app.Stop();
@@ -0,0 +1,107 @@
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/algorithm.h>
+#include "LuaMetaCache.h"
+
+namespace LuaVSCode
+{
+    AZ::IO::FixedMaxPath LuaMetaCache::GetEntryPath(AZ::u64 key) const
+    {
+        return m_root / AZStd::string::format("%016llx", static_cast<unsigned long long>(key));
+    }
+
+    bool LuaMetaCache::CopyFiles(const AZStd::vector<AZStd::string>& relativePaths, AZ::IO::PathView source, AZ::IO::PathView destination)
+    {
+        // AZ::IO has no portable hard link, the files are copied through the writer so unchanged
+        // destination files keep their timestamps and the others are replaced atomically
+        for (const AZStd::string& relativePath : relativePaths)
+        {
+            const AZ::IO::FixedMaxPath sourcePath = AZ::IO::FixedMaxPath(source) / relativePath;
+            const AZ::IO::FixedMaxPath destinationPath = AZ::IO::FixedMaxPath(destination) / relativePath;
+            if (!m_buffer.ReadFromFile(sourcePath.c_str()) || !m_buffer.WriteToFile(destinationPath.c_str()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool LuaMetaCache::Restore(AZ::u64 key, const AZStd::vector<AZStd::string>& relativePaths, AZ::IO::PathView metaPath)
+    {
+        if (!IsEnabled() || relativePaths.empty())
+        {
+            return false;
+        }
+
+        const AZ::IO::FixedMaxPath entryPath = GetEntryPath(key);
+        if (!AZ::IO::SystemFile::Exists((entryPath / relativePaths.back()).c_str()))
+        {
+            return false;
+        }
+
+        const bool restored = CopyFiles(relativePaths, entryPath, metaPath);
+        AZ_Warning("LuaVSCode", restored, "Meta cache entry '%s' is incomplete, generating instead", entryPath.c_str());
+        return restored;
+    }
+
+    bool LuaMetaCache::Publish(AZ::u64 key, const AZStd::vector<AZStd::string>& relativePaths, AZ::IO::PathView metaPath)
+    {
+        if (!IsEnabled() || relativePaths.empty())
+        {
+            return false;
+        }
+
+        const AZ::IO::FixedMaxPath entryPath = GetEntryPath(key);
+        if (AZ::IO::SystemFile::Exists((entryPath / relativePaths.back()).c_str()))
+        {
+            return true;
+        }
+
+        // Publishers of the same key on other machines may run at the same time. Each one fills its own staging folder
+        // and renames it to the entry, so an entry only ever holds the files of a single publisher. Renaming a folder
+        // onto an existing entry fails, then the staging folder is dropped and the other publisher's entry is kept.
+        const AZ::IO::FixedMaxPath stagingPath = m_root / AZStd::string::format("%016llx.%s.staging",
+            static_cast<unsigned long long>(key), AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str());
+        bool published = CopyFiles(relativePaths, metaPath, stagingPath);
+        if (published && !AZ::IO::SystemFile::Rename(stagingPath.c_str(), entryPath.c_str(), false))
+        {
+            published = AZ::IO::SystemFile::Exists((entryPath / relativePaths.back()).c_str());
+        }
+        DeleteFiles(relativePaths, stagingPath);
+        AZ_Warning("LuaVSCode", published, "Failed to publish meta to cache entry '%s'", entryPath.c_str());
+        return published;
+    }
+
+    void LuaMetaCache::DeleteFiles(const AZStd::vector<AZStd::string>& relativePaths, AZ::IO::PathView folder)
+    {
+        if (!AZ::IO::SystemFile::IsDirectory(AZ::IO::FixedMaxPath(folder).c_str()))
+        {
+            return;
+        }
+
+        AZStd::vector<AZ::IO::FixedMaxPath> folders;
+        for (const AZStd::string& relativePath : relativePaths)
+        {
+            const AZ::IO::FixedMaxPath filePath = AZ::IO::FixedMaxPath(folder) / relativePath;
+            AZ::IO::SystemFile::Delete(filePath.c_str());
+            for (AZ::IO::FixedMaxPath parent = filePath.ParentPath(); parent != folder && parent.IsRelativeTo(folder); parent = parent.ParentPath())
+            {
+                if (AZStd::find(folders.begin(), folders.end(), parent) == folders.end())
+                {
+                    folders.push_back(parent);
+                }
+            }
+        }
+
+        // deepest first so each folder is empty when it is deleted
+        AZStd::sort(folders.begin(), folders.end(), [](const AZ::IO::FixedMaxPath& lhs, const AZ::IO::FixedMaxPath& rhs)
+            {
+                return lhs.Native().size() > rhs.Native().size();
+            });
+        for (const AZ::IO::FixedMaxPath& subfolder : folders)
+        {
+            AZ::IO::SystemFile::DeleteDir(subfolder.c_str());
+        }
+        AZ::IO::SystemFile::DeleteDir(AZ::IO::FixedMaxPath(folder).c_str());
+    }
+} // namespace LuaVSCode
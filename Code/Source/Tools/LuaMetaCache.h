@@ -0,0 +1,38 @@
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include "LuaMetaWriter.h"
+
+namespace LuaVSCode
+{
+    //! Content addressed store of generated meta folders, shared between projects, branches and machines.
+    //! An entry is a copy of the meta folder in <root>/<key>, the key covers everything the output depends on
+    //! so an entry is never updated, only created. It is filled in a staging folder that is renamed to <key>
+    //! in one step, Restore() still checks the last file published is there.
+    class LuaMetaCache
+    {
+    public:
+        //! An empty root disables the cache
+        void SetRoot(AZ::IO::PathView root) { m_root = root; }
+        bool IsEnabled() const { return !m_root.empty(); }
+
+        //! Copies the entry for key into metaPath, returns false when there is no complete entry.
+        //! relativePaths lists the files of the entry, the last one is the completion marker.
+        bool Restore(AZ::u64 key, const AZStd::vector<AZStd::string>& relativePaths, AZ::IO::PathView metaPath);
+
+        //! Copies the files from metaPath into the entry for key unless it already exists
+        bool Publish(AZ::u64 key, const AZStd::vector<AZStd::string>& relativePaths, AZ::IO::PathView metaPath);
+
+    private:
+        AZ::IO::FixedMaxPath GetEntryPath(AZ::u64 key) const;
+        bool CopyFiles(const AZStd::vector<AZStd::string>& relativePaths, AZ::IO::PathView source, AZ::IO::PathView destination);
+        //! Deletes the files and then the folders they were in, folder included
+        void DeleteFiles(const AZStd::vector<AZStd::string>& relativePaths, AZ::IO::PathView folder);
+
+        AZ::IO::FixedMaxPath m_root;
+        // reused for every copied file
+        LuaMetaWriter m_buffer;
+    };
+} // namespace LuaVSCode
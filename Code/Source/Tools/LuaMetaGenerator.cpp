@@ -0,0 +1,1699 @@
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Module/ModuleManagerBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/RTTI/BehaviorContextUtilities.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/string/wildcard.h>
+#include <AzToolsFramework/Script/LuaSymbolsReporterBus.h>
+#include <LuaVSCode/LuaVSCodeBus.h>
+#include "LuaMetaGenerator.h"
+
+AZ_DEFINE_BUDGET(LuaVSCode);
+
+namespace LuaVSCode
+{
+    namespace
+    {
+        constexpr const char* MetaPath = "@projectroot@/scripts/meta/3rd/o3de";
+
+        // relative to MetaPath
+        constexpr const char* ConfigFileName = "config.json";
+        constexpr const char* FingerprintFileName = "fingerprint.json";
+        constexpr const char* IndexFileName = "index.json";
+        constexpr const char* SymbolDatabaseFileName = "symbols.bin";
+        constexpr const char* LibraryFolderName = "library";
+
+        // Lua language server workspace config, relative to the project root
+        constexpr const char* WorkspaceConfigFileName = ".luarc.json";
+        // marks a .luarc.json as generated, a hand written one is never overwritten
+        constexpr const char* WorkspaceConfigGeneratorKey = "$generator";
+        constexpr const char* WorkspaceConfigGenerator = "O3DE LuaVSCode";
+        // language server defaults, raised when the library needs more
+        constexpr AZ::u64 DefaultPreloadFileSizeKB = 500;
+        constexpr AZ::u64 DefaultMaxPreload = 5000;
+        // project folders that never hold scripts but can hold a lot of files
+        constexpr const char* WorkspaceIgnoreDirs[] = { "Cache", "build", "user", "_savebackup", ".git" };
+
+        // classes and EBuses are split into work items of this many symbols
+        constexpr size_t ClassesPerChunk = 32;
+        constexpr size_t EBusesPerChunk = 32;
+        // a chunk of 32 classes renders to a few KB, the writers grow past this when needed and keep their storage
+        // between generations. Only the per-file writer starts at LuaMetaWriter::DefaultCapacity.
+        constexpr size_t ChunkWriterCapacity = 4 * 1024;
+
+        // shard groups with fewer symbols than this are merged into the misc shard
+        constexpr size_t MinShardSize = 8;
+        constexpr const char* MiscShardGroup = "misc";
+
+        // the lean profile leaves out what reflection marks as not for listing or documentation
+        constexpr AZ::u64 LeanExcludeFlags = static_cast<AZ::u64>(AZ::Script::Attributes::ExcludeFlags::List) |
+            static_cast<AZ::u64>(AZ::Script::Attributes::ExcludeFlags::Documentation);
+
+        using PhaseClock = AZStd::chrono::steady_clock;
+
+        float GetElapsedMilliseconds(PhaseClock::time_point start)
+        {
+            return AZStd::chrono::duration<float, AZStd::milli>(PhaseClock::now() - start).count();
+        }
+
+        //! FNV-1a, used instead of AZStd::hash because fingerprints are persisted between runs
+        class StableHash
+        {
+        public:
+            void Add(AZStd::string_view value)
+            {
+                for (char c : value)
+                {
+                    AddByte(static_cast<AZ::u8>(c));
+                }
+                // separator so "ab" + "c" and "a" + "bc" hash differently
+                AddByte(0xff);
+            }
+
+            void Add(AZ::u64 value)
+            {
+                for (size_t i = 0; i < sizeof(value); ++i)
+                {
+                    AddByte(static_cast<AZ::u8>(value >> (i * 8)));
+                }
+            }
+
+            void Add(bool value)
+            {
+                AddByte(value ? 1 : 0);
+            }
+
+            AZ::u64 Get() const { return m_hash; }
+
+        private:
+            void AddByte(AZ::u8 byte)
+            {
+                m_hash ^= byte;
+                m_hash *= 0x100000001b3ull;
+            }
+
+            AZ::u64 m_hash = 0xcbf29ce484222325ull;
+        };
+
+        void HashMethod(StableHash& hash, const LuaMetaMethod& method)
+        {
+            hash.Add(method.m_name);
+            hash.Add(static_cast<AZ::u64>(method.m_kind));
+            hash.Add(method.m_hasSignature);
+            for (const auto& parameter : method.m_parameters)
+            {
+                hash.Add(parameter.m_name);
+                hash.Add(parameter.m_tooltip);
+            }
+            hash.Add(method.m_result);
+            hash.Add(method.m_debugArgumentInfo);
+        }
+
+        void HashClass(StableHash& hash, const LuaMetaClass& luaClass)
+        {
+            hash.Add(luaClass.m_name);
+            for (const auto& luaProperty : luaClass.m_properties)
+            {
+                hash.Add(luaProperty);
+            }
+            for (const auto& luaMethod : luaClass.m_methods)
+            {
+                HashMethod(hash, luaMethod);
+            }
+        }
+
+        void HashEBus(StableHash& hash, const LuaMetaEBus& ebus)
+        {
+            hash.Add(ebus.m_name);
+            hash.Add(ebus.m_hasSenders);
+            hash.Add(ebus.m_canBroadcast);
+            for (const auto& sender : ebus.m_senders)
+            {
+                HashMethod(hash, sender);
+            }
+        }
+
+        //! Writes through LuaMetaWriter so the file is only replaced, atomically, when its content changes
+        bool WriteJsonFile(const rapidjson::Document& document, const char* filePath)
+        {
+            AZStd::string jsonText;
+            if (!AZ::JsonSerializationUtils::WriteJsonString(document, jsonText).IsSuccess())
+            {
+                return false;
+            }
+
+            LuaMetaWriter writer(jsonText.size());
+            writer.Append(jsonText);
+            return writer.WriteToFile(filePath);
+        }
+
+        //! ExcludeFrom flags of a class, EBus or method, older reflection stores them as a plain u64
+        AZ::u64 GetExcludeFlags(const AZ::AttributeArray& attributes)
+        {
+            AZ::Attribute* attribute = AZ::FindAttribute(AZ::Script::Attributes::ExcludeFrom, attributes);
+            if (auto flags = azdynamic_cast<AZ::AttributeData<AZ::Script::Attributes::ExcludeFlags>*>(attribute))
+            {
+                return static_cast<AZ::u64>(flags->Get(nullptr));
+            }
+            if (auto flags = azdynamic_cast<AZ::AttributeData<AZ::u64>*>(attribute))
+            {
+                return flags->Get(nullptr);
+            }
+            return 0;
+        }
+
+        bool IsExcludedFromScript(const AZ::AttributeArray& attributes)
+        {
+            constexpr AZ::u64 All = static_cast<AZ::u64>(AZ::Script::Attributes::ExcludeFlags::All);
+            return (GetExcludeFlags(attributes) & All) == All;
+        }
+
+        AZStd::string_view GetCategory(const AZ::AttributeArray& attributes)
+        {
+            AZ::Attribute* attribute = AZ::FindAttribute(AZ::Script::Attributes::Category, attributes);
+            if (auto category = azdynamic_cast<AZ::AttributeData<const char*>*>(attribute))
+            {
+                const char* value = category->Get(nullptr);
+                return value ? value : "";
+            }
+            return {};
+        }
+
+        //! Shard a symbol is written to, the leading CamelCase word of its name.
+        //! "EditorEntityContextRequestBus" -> "editor", "AZStd" -> "az", "Vector3" -> "vector"
+        AZStd::string GetShardGroup(AZStd::string_view name)
+        {
+            if (name.empty() || !isalpha(static_cast<unsigned char>(name[0])))
+            {
+                return MiscShardGroup;
+            }
+
+            size_t end = 1;
+            if (name.size() > 1 && isupper(static_cast<unsigned char>(name[0])) && isupper(static_cast<unsigned char>(name[1])))
+            {
+                // acronym, stop before the capital that starts the next word
+                while (end < name.size() && isupper(static_cast<unsigned char>(name[end])) &&
+                    !(end + 1 < name.size() && islower(static_cast<unsigned char>(name[end + 1]))))
+                {
+                    ++end;
+                }
+            }
+            else
+            {
+                while (end < name.size() && islower(static_cast<unsigned char>(name[end])))
+                {
+                    ++end;
+                }
+            }
+
+            AZStd::string group(name.substr(0, end));
+            AZStd::to_lower(group.begin(), group.end());
+            return group;
+        }
+
+        typedef AZStd::unordered_map<AZ::Uuid, const AzToolsFramework::Script::LuaClassSymbol*> LuaClassUnorderedMap;
+
+        AZStd::string GetArgName(const char* argName, const AZ::BehaviorParameter* arg, const LuaClassUnorderedMap& luaClasses)
+        {
+            if (arg->m_typeId == AZ::AzTypeInfo<AZStd::string>::Uuid() ||
+                arg->m_typeId == AZ::AzTypeInfo<AZStd::basic_string<char, AZStd::char_traits<char>>>::Uuid())
+            {
+                return { "String" };
+            }
+            else if (arg->m_typeId == AZ::AzTypeInfo<AZ::u64>::Uuid())
+            {
+                return { "Number" };
+            }
+
+            auto itr = luaClasses.find(arg->m_typeId);
+            if (itr == luaClasses.end())
+            {
+                return AZ::ReplaceCppArtifacts(argName);
+            }
+
+            return AZ::ReplaceCppArtifacts(itr->second->m_name.c_str());
+        }
+
+        //! Memoizes GetArgName per type so each distinct Lua type name is resolved and stored once.
+        //! Lives for a single capture, next to the class map it resolves through.
+        class LuaTypeNameResolver
+        {
+        public:
+            LuaTypeNameResolver(const LuaClassUnorderedMap& luaClasses, LuaMetaStringPool& typeNames)
+                : m_luaClasses(luaClasses)
+                , m_typeNames(typeNames)
+            {
+                m_byTypeId.reserve(luaClasses.size() + 3);
+                m_byTypeId.emplace(AZ::AzTypeInfo<AZStd::string>::Uuid(), m_typeNames.Intern("String"));
+                m_byTypeId.emplace(AZ::AzTypeInfo<AZStd::basic_string<char, AZStd::char_traits<char>>>::Uuid(), m_typeNames.Intern("String"));
+                m_byTypeId.emplace(AZ::AzTypeInfo<AZ::u64>::Uuid(), m_typeNames.Intern("Number"));
+                for (const auto& luaClass : luaClasses)
+                {
+                    m_byTypeId.emplace(luaClass.first, m_typeNames.Intern(AZ::ReplaceCppArtifacts(luaClass.second->m_name.c_str())));
+                }
+            }
+
+            AZStd::string_view Resolve(const AZ::BehaviorParameter* arg)
+            {
+                if (auto itr = m_byTypeId.find(arg->m_typeId); itr != m_byTypeId.end())
+                {
+                    return itr->second;
+                }
+
+                // not a Lua class, GetArgName falls back to the C++ type name so memoize by that name instead
+                const AZStd::string_view cppName = arg->m_name ? arg->m_name : "";
+                if (auto itr = m_byCppName.find(cppName); itr != m_byCppName.end())
+                {
+                    return itr->second;
+                }
+
+                AZStd::string_view luaName = m_typeNames.Intern(GetArgName(arg->m_name, arg, m_luaClasses));
+                m_byCppName.emplace(cppName, luaName);
+                return luaName;
+            }
+
+        private:
+            const LuaClassUnorderedMap& m_luaClasses;
+            LuaMetaStringPool& m_typeNames;
+            AZStd::unordered_map<AZ::Uuid, AZStd::string_view> m_byTypeId;
+            // keys reference the BehaviorContext owned type names, which outlive the capture
+            AZStd::unordered_map<AZStd::string_view, AZStd::string_view> m_byCppName;
+        };
+
+        //! tooltips is nullptr when they are left out, otherwise they are interned in it
+        LuaMetaMethod CaptureLuaBehaviorMethod(const AZ::BehaviorMethod* behaviorMethod, const char* luaMethodName, LuaMetaMethodKind kind,
+            LuaTypeNameResolver& typeNames, LuaMetaStringPool* tooltips)
+        {
+            LuaMetaMethod method;
+            method.m_name = luaMethodName ? luaMethodName : behaviorMethod->m_name.c_str();
+            method.m_kind = kind;
+            method.m_hasSignature = true;
+
+            method.m_parameters.reserve(behaviorMethod->GetNumArguments());
+            for (size_t i = 0; i < behaviorMethod->GetNumArguments(); ++i)
+            {
+                auto arg = behaviorMethod->GetArgument(i);
+                auto tooltip = tooltips ? behaviorMethod->GetArgumentToolTip(i) : nullptr;
+
+                LuaMetaParameter& parameter = method.m_parameters.emplace_back();
+                parameter.m_name = typeNames.Resolve(arg);
+                if (tooltip != nullptr && !tooltip->empty())
+                {
+                    parameter.m_tooltip = tooltips->Intern(*tooltip);
+                }
+            }
+
+            if (auto methodResult = behaviorMethod->GetResult())
+            {
+                AZStd::string_view luaReturnArgName = typeNames.Resolve(methodResult);
+
+                // skip void types
+                if (!luaReturnArgName.empty() && luaReturnArgName != "void")
+                {
+                    method.m_result = luaReturnArgName;
+                }
+            }
+            return method;
+        }
+
+        // luaClassName is nullptr for global functions
+        void WriteLuaBehaviorMethod(const LuaMetaMethod& method, LuaMetaWriter& output, const char* luaClassName, LuaMetaScratch& scratch)
+        {
+            AZStd::string& params = scratch.m_params;
+            params.clear();
+
+            const char* separator = luaClassName ? "." : "";
+            luaClassName = luaClassName ? luaClassName : "";
+
+            // EBus senders reported by a remote script context only come with the debug argument info
+            const char* scope = method.m_kind == LuaMetaMethodKind::Event ? "Event."
+                : method.m_kind == LuaMetaMethodKind::Broadcast ? "Broadcast."
+                : "";
+
+            if (!method.m_hasSignature)
+            {
+                output.AppendFormat("function %s%s%s%s(%s) end\n", luaClassName, separator, scope, method.m_name.c_str(),
+                    method.m_debugArgumentInfo.c_str());
+                return;
+            }
+
+            for (size_t i = 0; i < method.m_parameters.size(); ++i)
+            {
+                const LuaMetaParameter& parameter = method.m_parameters[i];
+                if (!parameter.m_tooltip.empty())
+                {
+                    output.AppendFormat("---@param " AZ_STRING_FORMAT " " AZ_STRING_FORMAT "\n", AZ_STRING_ARG(parameter.m_name),
+                        AZ_STRING_ARG(parameter.m_tooltip));
+                }
+                else
+                {
+                    output.AppendFormat("---@param " AZ_STRING_FORMAT "\n", AZ_STRING_ARG(parameter.m_name));
+                }
+
+                if (i > 0)
+                {
+                    params.append(", ");
+                }
+                params.append(parameter.m_name);
+            }
+
+            if (!method.m_result.empty())
+            {
+                output.AppendFormat("---@return " AZ_STRING_FORMAT "\n", AZ_STRING_ARG(method.m_result));
+            }
+
+            output.AppendFormat("function %s%s%s%s(%s) end\n", luaClassName, separator, scope, method.m_name.c_str(), params.c_str());
+        }
+    }
+
+    AZ::u64 LuaMetaFingerprint::GetOutput(const AZStd::string& name) const
+    {
+        auto itr = m_outputs.find(name);
+        return itr != m_outputs.end() ? itr->second : 0;
+    }
+
+    bool LuaMetaFingerprint::Load(const char* filePath)
+    {
+        m_outputs.clear();
+        if (!AZ::IO::SystemFile::Exists(filePath))
+        {
+            return false;
+        }
+
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(filePath);
+        if (!readResult.IsSuccess() || !readResult.GetValue().IsObject())
+        {
+            AZ_Warning("LuaVSCode", false, "Ignoring unreadable meta fingerprint '%s'", filePath);
+            return false;
+        }
+
+        const rapidjson::Document& document = readResult.GetValue();
+        auto versionItr = document.FindMember("version");
+        if (versionItr == document.MemberEnd() || !versionItr->value.IsUint64())
+        {
+            return false;
+        }
+        m_version = versionItr->value.GetUint64();
+
+        auto outputsItr = document.FindMember("outputs");
+        if (outputsItr == document.MemberEnd() || !outputsItr->value.IsObject())
+        {
+            return false;
+        }
+
+        for (auto outputItr = outputsItr->value.MemberBegin(); outputItr != outputsItr->value.MemberEnd(); ++outputItr)
+        {
+            if (outputItr->value.IsUint64())
+            {
+                m_outputs.emplace(
+                    AZStd::string(outputItr->name.GetString(), outputItr->name.GetStringLength()), outputItr->value.GetUint64());
+            }
+        }
+        return true;
+    }
+
+    bool LuaMetaFingerprint::Save(const char* filePath) const
+    {
+        // sorted so the file only changes when a hash does
+        AZStd::vector<const AZStd::pair<const AZStd::string, AZ::u64>*> sortedOutputs;
+        sortedOutputs.reserve(m_outputs.size());
+        for (const auto& output : m_outputs)
+        {
+            sortedOutputs.push_back(&output);
+        }
+        AZStd::sort(sortedOutputs.begin(), sortedOutputs.end(), [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+
+        rapidjson::Document document;
+        document.SetObject();
+        document.AddMember("version", rapidjson::Value(m_version), document.GetAllocator());
+
+        rapidjson::Value outputs(rapidjson::kObjectType);
+        for (const auto* output : sortedOutputs)
+        {
+            outputs.AddMember(
+                rapidjson::Value(output->first.c_str(), static_cast<rapidjson::SizeType>(output->first.size()), document.GetAllocator()),
+                rapidjson::Value(output->second),
+                document.GetAllocator());
+        }
+        document.AddMember("outputs", outputs, document.GetAllocator());
+
+        const bool written = WriteJsonFile(document, filePath);
+        AZ_Warning("LuaVSCode", written, "Failed to write meta fingerprint '%s'", filePath);
+        return written;
+    }
+
+    void LuaMetaGeneratorSettings::Load()
+    {
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(m_sharded, "/O3DE/LuaVSCode/Meta/Sharded");
+            settingsRegistry->Get(m_generateOnActivate, "/O3DE/LuaVSCode/Meta/GenerateOnActivate");
+            settingsRegistry->Get(m_symbolDatabase, "/O3DE/LuaVSCode/Meta/SymbolDatabase");
+            settingsRegistry->Get(m_workspaceConfig, "/O3DE/LuaVSCode/Meta/WorkspaceConfig");
+            settingsRegistry->Get(m_cachePath, "/O3DE/LuaVSCode/Meta/CachePath");
+
+            AZStd::string profile;
+            if (settingsRegistry->Get(profile, "/O3DE/LuaVSCode/Meta/Profile"))
+            {
+                m_profile = AZ::StringFunc::Equal(profile, "Lean") ? LuaMetaProfile::Lean : LuaMetaProfile::Full;
+            }
+
+            auto loadPatterns = [settingsRegistry](AZStd::vector<AZStd::string>& patterns, AZStd::string_view path)
+            {
+                patterns.clear();
+                AZ::SettingsRegistryVisitorUtils::VisitArray(*settingsRegistry,
+                    [&patterns](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+                    {
+                        AZStd::string pattern;
+                        if (visitArgs.m_registry.Get(pattern, visitArgs.m_jsonKeyPath) && !pattern.empty())
+                        {
+                            patterns.push_back(AZStd::move(pattern));
+                        }
+                        return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+                    }, path);
+            };
+            loadPatterns(m_include, "/O3DE/LuaVSCode/Meta/Include");
+            loadPatterns(m_exclude, "/O3DE/LuaVSCode/Meta/Exclude");
+        }
+    }
+
+    bool LuaMetaGeneratorSettings::IsIncluded(AZStd::string_view name, AZStd::string_view category) const
+    {
+        auto matchesAny = [name, category](const AZStd::vector<AZStd::string>& patterns)
+        {
+            return AZStd::any_of(patterns.begin(), patterns.end(), [name, category](const AZStd::string& pattern)
+                {
+                    return AZStd::wildcard_match(pattern, name) || (!category.empty() && AZStd::wildcard_match(pattern, category));
+                });
+        };
+        return (m_include.empty() || matchesAny(m_include)) && !matchesAny(m_exclude);
+    }
+
+    void LuaMetaReflectionChanges::Add(LuaMetaSection section, AZStd::string_view name)
+    {
+        const size_t sectionIndex = static_cast<size_t>(section);
+        AZStd::string nameString(name);
+        m_removed[sectionIndex].erase(nameString);
+        AZStd::vector<AZStd::string>& added = m_added[sectionIndex];
+        if (AZStd::find(added.begin(), added.end(), nameString) == added.end())
+        {
+            added.push_back(AZStd::move(nameString));
+        }
+    }
+
+    void LuaMetaReflectionChanges::Remove(LuaMetaSection section, AZStd::string_view name)
+    {
+        const size_t sectionIndex = static_cast<size_t>(section);
+        AZStd::string nameString(name);
+        AZStd::vector<AZStd::string>& added = m_added[sectionIndex];
+        added.erase(AZStd::remove(added.begin(), added.end(), nameString), added.end());
+        m_removed[sectionIndex].insert(AZStd::move(nameString));
+    }
+
+    bool LuaMetaReflectionChanges::IsRemoved(LuaMetaSection section, AZStd::string_view name) const
+    {
+        const AZStd::unordered_set<AZStd::string>& removed = m_removed[static_cast<size_t>(section)];
+        return !removed.empty() && removed.find(AZStd::string(name)) != removed.end();
+    }
+
+    const char* LuaMetaGenerator::GetSectionName(LuaMetaSection section)
+    {
+        switch (section)
+        {
+        case LuaMetaSection::Classes:
+            return "classes";
+        case LuaMetaSection::EBuses:
+            return "ebuses";
+        case LuaMetaSection::Properties:
+            return "properties";
+        case LuaMetaSection::Functions:
+            return "functions";
+        default:
+            return "";
+        }
+    }
+
+    LuaMetaGenerator::~LuaMetaGenerator()
+    {
+        // a running job still references this generator
+        AZStd::unique_lock<AZStd::mutex> lock(m_completeMutex);
+        m_completeCondition.wait(lock, [this]() { return m_complete; });
+    }
+
+    bool LuaMetaGenerator::CaptureSymbols(const LuaMetaReflectionChanges& reflectionChanges)
+    {
+        AZ_PROFILE_FUNCTION(LuaVSCode);
+
+        auto bus = AzToolsFramework::Script::LuaSymbolsReporterRequestBus::FindFirstHandler();
+        if (!bus)
+        {
+            return false;
+        }
+
+        AZ::BehaviorContext* behaviorContext = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationBus::Events::GetBehaviorContext);
+        AZ_Assert(behaviorContext, "Cannot reflect types without BehaviorContext");
+        if (!behaviorContext)
+        {
+            return false;
+        }
+
+        ResolvePaths();
+        CaptureEnvironment();
+
+        LuaMetaGeneratorSettings settings;
+        settings.Load();
+        if (!settings.m_cachePath.empty())
+        {
+            char resolvedPath[AZ_MAX_PATH_LEN];
+            AZ::IO::FileIOBase::GetInstance()->ResolvePath(settings.m_cachePath.c_str(), resolvedPath, AZ_MAX_PATH_LEN);
+            settings.m_cachePath = resolvedPath;
+        }
+        SetSettings(settings);
+
+        CaptureSymbols(*behaviorContext, *bus, reflectionChanges);
+        return true;
+    }
+
+    void LuaMetaGenerator::CaptureSymbols(AZ::BehaviorContext& behaviorContext, AzToolsFramework::Script::LuaSymbolsReporterRequests& reporter,
+        const LuaMetaReflectionChanges& reflectionChanges)
+    {
+        const PhaseClock::time_point captureStart = PhaseClock::now();
+
+        m_symbols = {};
+
+        // filtered while capturing so the hashes, the cache key and every output only see what is written
+        const bool lean = m_settings.m_profile == LuaMetaProfile::Lean;
+        LuaMetaStringPool* tooltips = lean ? nullptr : &m_symbols.m_tooltips;
+        auto isCaptured = [this, lean](AZStd::string_view name, const AZ::AttributeArray& attributes)
+        {
+            if (lean && (GetExcludeFlags(attributes) & LeanExcludeFlags) != 0)
+            {
+                return false;
+            }
+            return m_settings.IsIncluded(name, GetCategory(attributes));
+        };
+
+        // the reporter and BehaviorContext queries are timed per call, there are thousands of lookups
+        // which would drown a profiler capture in tiny scopes
+        float symbolReporterMs = 0.0f;
+        float reflectionLookupMs = 0.0f;
+        PhaseClock::time_point queryStart = PhaseClock::now();
+
+        // get list of classes first so we can make user friendly types for parameters
+        const auto& classesList = reporter.GetListOfClasses();
+        symbolReporterMs += GetElapsedMilliseconds(queryStart);
+
+        LuaClassUnorderedMap classUuidToLuaClassSymbol;
+        classUuidToLuaClassSymbol.reserve(classesList.size());
+        for (const auto& luaClass : classesList)
+        {
+            classUuidToLuaClassSymbol.insert(AZStd::pair{ luaClass.m_typeId, &luaClass });
+        }
+
+        // classes reflected after the reporter built its lists are described the way the reporter would
+        queryStart = PhaseClock::now();
+        AZStd::vector<AzToolsFramework::Script::LuaClassSymbol> addedClasses;
+        for (const AZStd::string& className : reflectionChanges.m_added[static_cast<size_t>(LuaMetaSection::Classes)])
+        {
+            auto classIt = behaviorContext.m_classes.find(className);
+            if (classIt == behaviorContext.m_classes.end() ||
+                classUuidToLuaClassSymbol.find(classIt->second->m_typeId) != classUuidToLuaClassSymbol.end() ||
+                IsExcludedFromScript(classIt->second->m_attributes))
+            {
+                continue;
+            }
+
+            const AZ::BehaviorClass* behaviorClass = classIt->second;
+            AzToolsFramework::Script::LuaClassSymbol& luaClass = addedClasses.emplace_back();
+            luaClass.m_name = classIt->first;
+            luaClass.m_typeId = behaviorClass->m_typeId;
+            for (const auto& propertyIt : behaviorClass->m_properties)
+            {
+                if (!IsExcludedFromScript(propertyIt.second->m_attributes))
+                {
+                    luaClass.m_properties.emplace_back().m_name = propertyIt.first;
+                }
+            }
+            for (const auto& methodIt : behaviorClass->m_methods)
+            {
+                if (!IsExcludedFromScript(methodIt.second->m_attributes))
+                {
+                    luaClass.m_methods.emplace_back().m_name = methodIt.first;
+                }
+            }
+        }
+        reflectionLookupMs += GetElapsedMilliseconds(queryStart);
+
+        // pointers are taken once addedClasses stops growing
+        AZStd::vector<const AzToolsFramework::Script::LuaClassSymbol*> luaClasses;
+        luaClasses.reserve(classesList.size() + addedClasses.size());
+        for (const auto& luaClass : classesList)
+        {
+            if (!reflectionChanges.IsRemoved(LuaMetaSection::Classes, luaClass.m_name))
+            {
+                luaClasses.push_back(&luaClass);
+            }
+        }
+        for (const auto& luaClass : addedClasses)
+        {
+            if (classUuidToLuaClassSymbol.insert(AZStd::pair{ luaClass.m_typeId, &luaClass }).second)
+            {
+                luaClasses.push_back(&luaClass);
+            }
+        }
+        LuaTypeNameResolver typeNames(classUuidToLuaClassSymbol, m_symbols.m_typeNames);
+
+        m_symbols.m_classes.reserve(luaClasses.size());
+        for (const AzToolsFramework::Script::LuaClassSymbol* luaClassSymbol : luaClasses)
+        {
+            const auto& luaClass = *luaClassSymbol;
+            queryStart = PhaseClock::now();
+            auto behaviorClass = behaviorContext.FindClassByTypeId(luaClass.m_typeId);
+            reflectionLookupMs += GetElapsedMilliseconds(queryStart);
+            // ExcludeFlags::All is already left out by the symbol reporter and addedClasses
+            if (!behaviorClass || !isCaptured(luaClass.m_name, behaviorClass->m_attributes))
+            {
+                continue;
+            }
+
+            LuaMetaClass& metaClass = m_symbols.m_classes.emplace_back();
+            metaClass.m_name = luaClass.m_name;
+            metaClass.m_typeId = luaClass.m_typeId;
+
+            metaClass.m_properties.reserve(luaClass.m_properties.size());
+            for (const auto& luaProperties : luaClass.m_properties)
+            {
+                metaClass.m_properties.push_back(luaProperties.m_name);
+            }
+
+            metaClass.m_methods.reserve(luaClass.m_methods.size());
+            for (const auto& luaMethods : luaClass.m_methods)
+            {
+                if (luaMethods.m_name == "AcquireOwnership" || luaMethods.m_name == "ReleaseOwnership")
+                {
+                    continue;
+                }
+
+                queryStart = PhaseClock::now();
+                auto behaviorMethod = behaviorClass->FindMethodByReflectedName(luaMethods.m_name.c_str());
+                reflectionLookupMs += GetElapsedMilliseconds(queryStart);
+                if (behaviorMethod)
+                {
+                    if (lean && (GetExcludeFlags(behaviorMethod->m_attributes) & LeanExcludeFlags) != 0)
+                    {
+                        continue;
+                    }
+                    metaClass.m_methods.push_back(CaptureLuaBehaviorMethod(
+                        behaviorMethod, luaMethods.m_name.c_str(), LuaMetaMethodKind::Function, typeNames, tooltips));
+                }
+                else
+                {
+                    LuaMetaMethod& method = metaClass.m_methods.emplace_back();
+                    method.m_name = luaMethods.m_name;
+                    method.m_debugArgumentInfo = luaMethods.m_debugArgumentInfo;
+                }
+            }
+        }
+
+        // EBUSES
+        queryStart = PhaseClock::now();
+        const auto& ebusesList = reporter.GetListOfEBuses();
+        symbolReporterMs += GetElapsedMilliseconds(queryStart);
+
+        queryStart = PhaseClock::now();
+        AZStd::unordered_set<AZStd::string_view> reportedNames;
+        reportedNames.reserve(ebusesList.size());
+        for (const auto& ebus : ebusesList)
+        {
+            reportedNames.emplace(ebus.m_name);
+        }
+        AZStd::vector<AzToolsFramework::Script::LuaEBusSymbol> addedEBuses;
+        for (const AZStd::string& ebusName : reflectionChanges.m_added[static_cast<size_t>(LuaMetaSection::EBuses)])
+        {
+            auto ebusIt = behaviorContext.m_ebuses.find(ebusName);
+            if (ebusIt == behaviorContext.m_ebuses.end() || reportedNames.find(ebusIt->first) != reportedNames.end() ||
+                IsExcludedFromScript(ebusIt->second->m_attributes))
+            {
+                continue;
+            }
+
+            AzToolsFramework::Script::LuaEBusSymbol& luaEBus = addedEBuses.emplace_back();
+            luaEBus.m_name = ebusIt->first;
+            for (const auto& senderIt : ebusIt->second->m_events)
+            {
+                luaEBus.m_senders.emplace_back().m_name = senderIt.first;
+                luaEBus.m_canBroadcast = luaEBus.m_canBroadcast || senderIt.second.m_broadcast != nullptr;
+            }
+        }
+        reflectionLookupMs += GetElapsedMilliseconds(queryStart);
+
+        AZStd::vector<const AzToolsFramework::Script::LuaEBusSymbol*> luaEBuses;
+        luaEBuses.reserve(ebusesList.size() + addedEBuses.size());
+        for (const auto& ebus : ebusesList)
+        {
+            if (!reflectionChanges.IsRemoved(LuaMetaSection::EBuses, ebus.m_name))
+            {
+                luaEBuses.push_back(&ebus);
+            }
+        }
+        for (const auto& ebus : addedEBuses)
+        {
+            luaEBuses.push_back(&ebus);
+        }
+        m_symbols.m_ebuses.reserve(luaEBuses.size());
+
+        // sender names indexed once per bus instead of scanning m_senders for every event,
+        // reused between buses so the buckets are only allocated once
+        AZStd::unordered_map<AZStd::string_view, const char*> luaSenderNames;
+        auto findLuaSenderName = [&luaSenderNames](const AZ::BehaviorMethod* behaviorMethod) -> const char*
+        {
+            auto itr = luaSenderNames.find(AZStd::string_view(behaviorMethod->m_name));
+            return itr != luaSenderNames.end() ? itr->second : nullptr;
+        };
+
+        for (const AzToolsFramework::Script::LuaEBusSymbol* luaEBusSymbol : luaEBuses)
+        {
+            const auto& ebus = *luaEBusSymbol;
+            queryStart = PhaseClock::now();
+            auto behaviorEBus = behaviorContext.FindEBusByReflectedName(ebus.m_name);
+            reflectionLookupMs += GetElapsedMilliseconds(queryStart);
+            if (!behaviorEBus || !isCaptured(ebus.m_name, behaviorEBus->m_attributes))
+            {
+                continue;
+            }
+
+            LuaMetaEBus& metaEBus = m_symbols.m_ebuses.emplace_back();
+            metaEBus.m_name = ebus.m_name;
+            metaEBus.m_hasSenders = !ebus.m_senders.empty();
+            metaEBus.m_canBroadcast = ebus.m_canBroadcast;
+
+            luaSenderNames.clear();
+            for (const auto& luaSenders : ebus.m_senders)
+            {
+                // emplace keeps the first sender with a name, matching the order of the old linear search
+                luaSenderNames.emplace(AZStd::string_view(luaSenders.m_name), luaSenders.m_name.c_str());
+            }
+
+            metaEBus.m_senders.reserve(behaviorEBus->m_events.size() * (ebus.m_canBroadcast ? 2 : 1));
+            for (const auto& senderIt : behaviorEBus->m_events)
+            {
+                const AZ::BehaviorEBusEventSender& sender = senderIt.second;
+                if (lean && (GetExcludeFlags(sender.m_attributes) & LeanExcludeFlags) != 0)
+                {
+                    continue;
+                }
+
+                const char* luaMethodName = nullptr;
+                if (sender.m_event)
+                {
+                    luaMethodName = findLuaSenderName(sender.m_event);
+                    metaEBus.m_senders.push_back(CaptureLuaBehaviorMethod(
+                        sender.m_event, luaMethodName, LuaMetaMethodKind::Event, typeNames, tooltips));
+                }
+
+                if (sender.m_broadcast)
+                {
+                    if (!luaMethodName)
+                    {
+                        luaMethodName = findLuaSenderName(sender.m_broadcast);
+                    }
+                    metaEBus.m_senders.push_back(CaptureLuaBehaviorMethod(
+                        sender.m_broadcast, luaMethodName, LuaMetaMethodKind::Broadcast, typeNames, tooltips));
+                }
+            }
+        }
+
+        // Global properties
+        queryStart = PhaseClock::now();
+        const auto& globalProperties = reporter.GetListOfGlobalProperties();
+        symbolReporterMs += GetElapsedMilliseconds(queryStart);
+
+        // globals are filtered like classes and EBuses, the reporter lists only carry their names
+        queryStart = PhaseClock::now();
+        auto isPropertyCaptured = [&behaviorContext, &isCaptured](const AZStd::string& name)
+        {
+            auto propertyIt = behaviorContext.m_properties.find(name);
+            return propertyIt != behaviorContext.m_properties.end() && isCaptured(name, propertyIt->second->m_attributes);
+        };
+        m_symbols.m_globalProperties.reserve(globalProperties.size());
+        reportedNames.clear();
+        for (const auto& globalProperty : globalProperties)
+        {
+            reportedNames.emplace(globalProperty.m_name);
+            if (!reflectionChanges.IsRemoved(LuaMetaSection::Properties, globalProperty.m_name) && isPropertyCaptured(globalProperty.m_name))
+            {
+                m_symbols.m_globalProperties.push_back(globalProperty.m_name);
+            }
+        }
+        for (const AZStd::string& propertyName : reflectionChanges.m_added[static_cast<size_t>(LuaMetaSection::Properties)])
+        {
+            auto propertyIt = behaviorContext.m_properties.find(propertyName);
+            if (propertyIt != behaviorContext.m_properties.end() && reportedNames.find(propertyName) == reportedNames.end() &&
+                !IsExcludedFromScript(propertyIt->second->m_attributes) && isCaptured(propertyName, propertyIt->second->m_attributes))
+            {
+                m_symbols.m_globalProperties.push_back(propertyName);
+            }
+        }
+        reflectionLookupMs += GetElapsedMilliseconds(queryStart);
+
+        // Global functions
+        queryStart = PhaseClock::now();
+        const auto& globalFunctions = reporter.GetListOfGlobalFunctions();
+        symbolReporterMs += GetElapsedMilliseconds(queryStart);
+
+        queryStart = PhaseClock::now();
+        m_symbols.m_globalFunctions.reserve(globalFunctions.size());
+        reportedNames.clear();
+        for (const auto& globalFunction : globalFunctions)
+        {
+            reportedNames.emplace(globalFunction.m_name);
+            auto methodIt = behaviorContext.m_methods.find(globalFunction.m_name);
+            if (reflectionChanges.IsRemoved(LuaMetaSection::Functions, globalFunction.m_name) ||
+                methodIt == behaviorContext.m_methods.end() || !isCaptured(globalFunction.m_name, methodIt->second->m_attributes))
+            {
+                continue;
+            }
+
+            LuaMetaMethod& method = m_symbols.m_globalFunctions.emplace_back();
+            method.m_name = globalFunction.m_name;
+            method.m_debugArgumentInfo = globalFunction.m_debugArgumentInfo;
+        }
+        for (const AZStd::string& functionName : reflectionChanges.m_added[static_cast<size_t>(LuaMetaSection::Functions)])
+        {
+            auto methodIt = behaviorContext.m_methods.find(functionName);
+            if (methodIt != behaviorContext.m_methods.end() && reportedNames.find(functionName) == reportedNames.end() &&
+                !IsExcludedFromScript(methodIt->second->m_attributes) && isCaptured(functionName, methodIt->second->m_attributes))
+            {
+                m_symbols.m_globalFunctions.push_back(CaptureLuaBehaviorMethod(
+                    methodIt->second, functionName.c_str(), LuaMetaMethodKind::Function, typeNames, tooltips));
+            }
+        }
+        reflectionLookupMs += GetElapsedMilliseconds(queryStart);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+            m_stats.m_captureMs = GetElapsedMilliseconds(captureStart);
+            m_stats.m_symbolReporterMs = symbolReporterMs;
+            m_stats.m_reflectionLookupMs = reflectionLookupMs;
+        }
+    }
+
+    void LuaMetaGenerator::ResolvePaths()
+    {
+        char resolvedPath[AZ_MAX_PATH_LEN];
+        AZ::IO::FileIOBase::GetInstance()->ResolvePath(MetaPath, resolvedPath, AZ_MAX_PATH_LEN);
+        SetOutputPath(resolvedPath);
+
+        AZ::IO::FileIOBase::GetInstance()->ResolvePath("@projectroot@", resolvedPath, AZ_MAX_PATH_LEN);
+        SetProjectPath(resolvedPath);
+    }
+
+    void LuaMetaGenerator::SetProjectPath(AZ::IO::PathView projectPath)
+    {
+        m_projectPath = projectPath;
+        m_workspaceConfigFilePath = m_projectPath / WorkspaceConfigFileName;
+    }
+
+    void LuaMetaGenerator::SetOutputPath(AZ::IO::PathView metaPath)
+    {
+        m_metaPath = metaPath;
+        m_configFilePath = metaPath / ConfigFileName;
+        m_fingerprintFilePath = metaPath / FingerprintFileName;
+        m_indexFilePath = metaPath / IndexFileName;
+        m_symbolDatabaseFilePath = metaPath / SymbolDatabaseFileName;
+        m_libraryPath = metaPath / LibraryFolderName;
+    }
+
+    void LuaMetaGenerator::SetSettings(const LuaMetaGeneratorSettings& settings)
+    {
+        m_settings = settings;
+        m_cache.SetRoot(m_settings.m_cachePath);
+    }
+
+    void LuaMetaGenerator::CaptureEnvironment()
+    {
+        m_engineVersion.clear();
+        m_gemNames.clear();
+
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(m_engineVersion,
+                AZ::SettingsRegistryInterface::FixedValueString(AZ::SettingsRegistryMergeUtils::EngineSettingsRootKey) + "/version");
+        }
+
+        AZ::ModuleManagerRequestBus::Broadcast(&AZ::ModuleManagerRequests::EnumerateModules, [this](const AZ::ModuleData& moduleData)
+            {
+                m_gemNames.push_back(moduleData.GetDebugName());
+                return true;
+            });
+        AZStd::sort(m_gemNames.begin(), m_gemNames.end());
+    }
+
+    void LuaMetaGenerator::SetSymbols(LuaMetaSymbols&& symbols)
+    {
+        m_symbols = AZStd::move(symbols);
+    }
+
+    LuaMetaOutput& LuaMetaGenerator::AddOutput(size_t& outputCount, LuaMetaSection section, const AZStd::string& name)
+    {
+        if (outputCount == m_outputs.size())
+        {
+            m_outputs.emplace_back();
+        }
+
+        LuaMetaOutput& output = m_outputs[outputCount++];
+        output.m_section = section;
+        output.m_name = name;
+        output.m_items.clear();
+        output.m_hash = 0;
+        output.m_filePath = m_libraryPath / AZStd::string::format("%s.lua", name.c_str());
+        output.m_stale = false;
+        output.m_written = false;
+        output.m_unchanged = false;
+        output.m_bytesWritten = 0;
+        output.m_writeCalls = 0;
+        return output;
+    }
+
+    void LuaMetaGenerator::AddShardedOutputs(size_t& outputCount, LuaMetaSection section, const AZStd::vector<AZStd::string_view>& names)
+    {
+        // ordered so the shards, and the index that lists them, come out the same on every run
+        AZStd::map<AZStd::string, AZStd::vector<size_t>> groups;
+        for (size_t itemIndex = 0; itemIndex < names.size(); ++itemIndex)
+        {
+            groups[GetShardGroup(names[itemIndex])].push_back(itemIndex);
+        }
+
+        // lots of tiny files cost the language server more than they save
+        AZStd::vector<size_t>& misc = groups[MiscShardGroup];
+        for (auto itr = groups.begin(); itr != groups.end();)
+        {
+            if (itr->first != MiscShardGroup && itr->second.size() < MinShardSize)
+            {
+                misc.insert(misc.end(), itr->second.begin(), itr->second.end());
+                itr = groups.erase(itr);
+            }
+            else
+            {
+                ++itr;
+            }
+        }
+        AZStd::sort(misc.begin(), misc.end());
+
+        for (auto& [group, items] : groups)
+        {
+            if (items.empty())
+            {
+                continue;
+            }
+
+            LuaMetaOutput& output = AddOutput(outputCount, section, AZStd::string::format("%s/%s", GetSectionName(section), group.c_str()));
+            output.m_items.swap(items);
+        }
+    }
+
+    void LuaMetaGenerator::BuildOutputs()
+    {
+        AZ_PROFILE_FUNCTION(LuaVSCode);
+        size_t outputCount = 0;
+        auto addSection = [this, &outputCount](LuaMetaSection section, size_t itemCount)
+        {
+            LuaMetaOutput& output = AddOutput(outputCount, section, GetSectionName(section));
+            output.m_items.resize(itemCount);
+            for (size_t itemIndex = 0; itemIndex < itemCount; ++itemIndex)
+            {
+                output.m_items[itemIndex] = itemIndex;
+            }
+        };
+
+        if (m_settings.m_sharded)
+        {
+            AZStd::vector<AZStd::string_view> names;
+            names.reserve(AZStd::max(m_symbols.m_classes.size(), m_symbols.m_ebuses.size()));
+            for (const auto& luaClass : m_symbols.m_classes)
+            {
+                names.push_back(luaClass.m_name);
+            }
+            AddShardedOutputs(outputCount, LuaMetaSection::Classes, names);
+
+            names.clear();
+            for (const auto& ebus : m_symbols.m_ebuses)
+            {
+                names.push_back(ebus.m_name);
+            }
+            AddShardedOutputs(outputCount, LuaMetaSection::EBuses, names);
+        }
+        else
+        {
+            addSection(LuaMetaSection::Classes, m_symbols.m_classes.size());
+            addSection(LuaMetaSection::EBuses, m_symbols.m_ebuses.size());
+        }
+        addSection(LuaMetaSection::Properties, m_symbols.m_globalProperties.size());
+        addSection(LuaMetaSection::Functions, m_symbols.m_globalFunctions.size());
+        m_outputs.resize(outputCount);
+
+        for (LuaMetaOutput& output : m_outputs)
+        {
+            StableHash hash;
+            for (size_t itemIndex : output.m_items)
+            {
+                switch (output.m_section)
+                {
+                case LuaMetaSection::Classes:
+                    HashClass(hash, m_symbols.m_classes[itemIndex]);
+                    break;
+                case LuaMetaSection::EBuses:
+                    HashEBus(hash, m_symbols.m_ebuses[itemIndex]);
+                    break;
+                case LuaMetaSection::Properties:
+                    hash.Add(m_symbols.m_globalProperties[itemIndex]);
+                    break;
+                case LuaMetaSection::Functions:
+                    HashMethod(hash, m_symbols.m_globalFunctions[itemIndex]);
+                    break;
+                default:
+                    break;
+                }
+            }
+            output.m_hash = hash.Get();
+        }
+    }
+
+    bool LuaMetaGenerator::Generate()
+    {
+        AZ_PROFILE_FUNCTION(LuaVSCode);
+        const PhaseClock::time_point generateStart = PhaseClock::now();
+
+        LuaMetaGenerationStats stats = GetStats();
+        stats.m_classCount = m_symbols.m_classes.size();
+        stats.m_methodCount = 0;
+        for (const LuaMetaClass& luaClass : m_symbols.m_classes)
+        {
+            stats.m_methodCount += luaClass.m_methods.size();
+        }
+        stats.m_ebusCount = m_symbols.m_ebuses.size();
+        stats.m_ebusSenderCount = 0;
+        for (const LuaMetaEBus& ebus : m_symbols.m_ebuses)
+        {
+            stats.m_ebusSenderCount += ebus.m_senders.size();
+        }
+        stats.m_globalPropertyCount = m_symbols.m_globalProperties.size();
+        stats.m_globalFunctionCount = m_symbols.m_globalFunctions.size();
+        stats.m_filesWritten = 0;
+        stats.m_filesUnchanged = 0;
+        stats.m_bytesWritten = 0;
+        stats.m_writeCalls = 0;
+        stats.m_restoredFromCache = false;
+        stats.m_renderMs = 0.0f;
+        stats.m_writeMs = 0.0f;
+
+        WriteConfig();
+
+        const PhaseClock::time_point hashStart = PhaseClock::now();
+        BuildOutputs();
+        stats.m_hashMs = GetElapsedMilliseconds(hashStart);
+        stats.m_filesTotal = m_outputs.size();
+
+        LuaMetaFingerprint fingerprint;
+        for (const LuaMetaOutput& output : m_outputs)
+        {
+            fingerprint.SetOutput(output.m_name, output.m_hash);
+        }
+
+        // later generations in the same session diff against what was last written instead of reading it back
+        if (!m_hasLastFingerprint)
+        {
+            m_hasLastFingerprint = m_lastFingerprint.Load(m_fingerprintFilePath.c_str()) &&
+                m_lastFingerprint.m_version == LuaMetaFingerprint::GeneratorVersion;
+        }
+        const LuaMetaFingerprint previousFingerprint = m_lastFingerprint;
+        const bool hasPreviousFingerprint = m_hasLastFingerprint;
+
+        size_t itemsTotal = 0;
+        size_t staleOutputs = 0;
+        for (LuaMetaOutput& output : m_outputs)
+        {
+            output.m_stale = !hasPreviousFingerprint || previousFingerprint.GetOutput(output.m_name) != output.m_hash ||
+                !AZ::IO::SystemFile::Exists(output.m_filePath.c_str());
+            if (output.m_stale)
+            {
+                itemsTotal += output.m_items.size();
+                ++staleOutputs;
+            }
+        }
+        size_t removedOutputs = 0;
+        for (const auto& previousOutput : previousFingerprint.m_outputs)
+        {
+            if (fingerprint.m_outputs.find(previousOutput.first) == fingerprint.m_outputs.end())
+            {
+                ++removedOutputs;
+            }
+        }
+        const bool outputsChanged = staleOutputs > 0 || removedOutputs > 0;
+        AZ_TracePrintf("LuaVSCode", "Writing %zu of %zu meta files and removing %zu, the rest have not changed\n",
+            staleOutputs, m_outputs.size(), removedOutputs);
+        m_itemsWritten = 0;
+        m_itemsTotal = itemsTotal;
+
+        const bool writeSymbolDatabase = m_settings.m_symbolDatabase &&
+            (outputsChanged || !hasPreviousFingerprint || !AZ::IO::SystemFile::Exists(m_symbolDatabaseFilePath.c_str()));
+
+        // another machine or branch may already have generated this exact reflection
+        const AZ::u64 cacheKey = GetCacheKey();
+        bool restored = false;
+        if (m_cache.IsEnabled() && (outputsChanged || !hasPreviousFingerprint))
+        {
+            AZ_PROFILE_SCOPE(LuaVSCode, "LuaMetaGenerator::RestoreCache");
+            const PhaseClock::time_point restoreStart = PhaseClock::now();
+            restored = m_cache.Restore(cacheKey, GetCacheFiles(), m_metaPath);
+            stats.m_writeMs += GetElapsedMilliseconds(restoreStart);
+        }
+
+        bool success = true;
+        if (restored)
+        {
+            AZ_TracePrintf("LuaVSCode", "Restored meta from cache entry %016llx\n", static_cast<unsigned long long>(cacheKey));
+            m_itemsWritten = itemsTotal;
+            stats.m_restoredFromCache = true;
+        }
+        else
+        {
+            success = WriteStaleOutputs(writeSymbolDatabase, stats);
+        }
+
+        RemoveStaleFiles(previousFingerprint, hasPreviousFingerprint);
+        if (success && m_settings.m_workspaceConfig)
+        {
+            WriteWorkspaceConfig();
+        }
+
+        // a failed file keeps the old fingerprint so it is retried on the next run
+        if (success && (outputsChanged || !hasPreviousFingerprint))
+        {
+            fingerprint.Save(m_fingerprintFilePath.c_str());
+        }
+        if (success)
+        {
+            m_lastFingerprint = AZStd::move(fingerprint);
+            m_hasLastFingerprint = true;
+        }
+
+        if (success && !restored && outputsChanged && m_cache.IsEnabled())
+        {
+            AZ_PROFILE_SCOPE(LuaVSCode, "LuaMetaGenerator::PublishCache");
+            m_cache.Publish(cacheKey, GetCacheFiles(), m_metaPath);
+        }
+
+        stats.m_generateMs = GetElapsedMilliseconds(generateStart);
+        AZ_TracePrintf("LuaVSCode",
+            "Meta generation: %llu classes, %llu methods, %llu EBuses, %llu senders, %llu/%llu files written (%llu unchanged%s), "
+            "%llu bytes in %llu write calls, capture %.1fms (reporter %.1fms, lookups %.1fms), hash %.1fms, render %.1fms, "
+            "write %.1fms, generate %.1fms\n",
+            static_cast<unsigned long long>(stats.m_classCount), static_cast<unsigned long long>(stats.m_methodCount),
+            static_cast<unsigned long long>(stats.m_ebusCount), static_cast<unsigned long long>(stats.m_ebusSenderCount),
+            static_cast<unsigned long long>(stats.m_filesWritten), static_cast<unsigned long long>(stats.m_filesTotal),
+            static_cast<unsigned long long>(stats.m_filesUnchanged), stats.m_restoredFromCache ? ", restored from cache" : "",
+            static_cast<unsigned long long>(stats.m_bytesWritten), static_cast<unsigned long long>(stats.m_writeCalls),
+            stats.m_captureMs, stats.m_symbolReporterMs, stats.m_reflectionLookupMs, stats.m_hashMs, stats.m_renderMs,
+            stats.m_writeMs, stats.m_generateMs);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+            m_stats = stats;
+        }
+        return success;
+    }
+
+    bool LuaMetaGenerator::WriteStaleOutputs(bool writeSymbolDatabase, LuaMetaGenerationStats& stats)
+    {
+        AZ_PROFILE_FUNCTION(LuaVSCode);
+
+        // every work item renders into its own chunk, the chunks are concatenated in order
+        // so the output is identical to a serial run
+        const PhaseClock::time_point renderStart = PhaseClock::now();
+        AZ::JobCompletion renderCompletion;
+        for (LuaMetaOutput& output : m_outputs)
+        {
+            if (!output.m_stale)
+            {
+                continue;
+            }
+
+            const size_t itemCount = output.m_items.size();
+            const size_t itemsPerChunk = output.m_section == LuaMetaSection::Classes ? ClassesPerChunk
+                : output.m_section == LuaMetaSection::EBuses ? EBusesPerChunk
+                : AZStd::max<size_t>(itemCount, 1);
+            output.m_chunks.resize((itemCount + itemsPerChunk - 1) / itemsPerChunk, LuaMetaWriter(ChunkWriterCapacity));
+            for (size_t chunkIndex = 0; chunkIndex < output.m_chunks.size(); ++chunkIndex)
+            {
+                output.m_chunks[chunkIndex].Clear();
+                const size_t begin = chunkIndex * itemsPerChunk;
+                const size_t end = AZStd::min(begin + itemsPerChunk, itemCount);
+                AZ::Job* job = AZ::CreateJobFunction([this, &output, begin, end, &writer = output.m_chunks[chunkIndex]]()
+                    {
+                        AZ_PROFILE_SCOPE(LuaVSCode, "LuaMetaGenerator::RenderItems");
+                        LuaMetaScratch scratch;
+                        RenderItems(output, begin, end, writer, scratch);
+                    }, true);
+                job->SetDependent(&renderCompletion);
+                job->Start();
+            }
+        }
+        // the jobs start as they are created, so render time runs from the first one
+        renderCompletion.StartAndWaitForCompletion();
+        stats.m_renderMs = GetElapsedMilliseconds(renderStart);
+
+        const PhaseClock::time_point writeStart = PhaseClock::now();
+        AZ::JobCompletion writeCompletion;
+        bool symbolDatabaseWritten = false;
+        size_t symbolDatabaseWriteCalls = 0;
+        if (writeSymbolDatabase)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([this, &symbolDatabaseWritten, &symbolDatabaseWriteCalls]()
+                {
+                    AZ_PROFILE_SCOPE(LuaVSCode, "LuaMetaGenerator::WriteSymbolDatabase");
+                    StableHash hash;
+                    for (const LuaMetaOutput& output : m_outputs)
+                    {
+                        hash.Add(output.m_hash);
+                    }
+                    m_symbolDatabaseWriter.Write(m_symbols, hash.Get(), m_symbolDatabaseOutput);
+                    const size_t writeCount = m_symbolDatabaseOutput.GetWriteCount();
+                    symbolDatabaseWritten = m_symbolDatabaseOutput.WriteToFile(m_symbolDatabaseFilePath.c_str());
+                    symbolDatabaseWriteCalls = m_symbolDatabaseOutput.GetWriteCount() - writeCount;
+                    AZ_Warning("LuaVSCode", symbolDatabaseWritten, "Failed to write symbol database '%s'", m_symbolDatabaseFilePath.c_str());
+                }, true);
+            job->SetDependent(&writeCompletion);
+            job->Start();
+        }
+
+        for (LuaMetaOutput& output : m_outputs)
+        {
+            if (!output.m_stale)
+            {
+                continue;
+            }
+
+            AZ::Job* job = AZ::CreateJobFunction([this, &output]()
+                {
+                    AZ_PROFILE_SCOPE(LuaVSCode, "LuaMetaGenerator::WriteOutput");
+                    output.m_written = WriteOutput(output);
+                    // rendering finishes before any output is written, so items count once their file is on disk
+                    m_itemsWritten += output.m_items.size();
+                    LuaVSCodeNotificationBus::QueueBroadcast(&LuaVSCodeNotifications::OnMetaGenerationProgress, GetProgress());
+                }, true);
+            job->SetDependent(&writeCompletion);
+            job->Start();
+        }
+        writeCompletion.StartAndWaitForCompletion();
+
+        bool success = true;
+        for (const LuaMetaOutput& output : m_outputs)
+        {
+            if (output.m_stale)
+            {
+                success &= output.m_written;
+                stats.m_filesWritten += output.m_written && !output.m_unchanged ? 1 : 0;
+                stats.m_filesUnchanged += output.m_unchanged ? 1 : 0;
+                stats.m_bytesWritten += output.m_bytesWritten;
+                stats.m_writeCalls += output.m_writeCalls;
+            }
+        }
+        if (writeSymbolDatabase)
+        {
+            success &= symbolDatabaseWritten;
+            stats.m_writeCalls += symbolDatabaseWriteCalls;
+            stats.m_bytesWritten += symbolDatabaseWritten && symbolDatabaseWriteCalls > 0 ? m_symbolDatabaseOutput.GetSize() : 0;
+        }
+
+        if (m_settings.m_sharded)
+        {
+            success &= WriteIndex();
+        }
+        stats.m_writeMs += GetElapsedMilliseconds(writeStart);
+        return success;
+    }
+
+    AZ::u64 LuaMetaGenerator::GetCacheKey() const
+    {
+        // everything the files depend on, so an entry never has to be invalidated
+        StableHash hash;
+        hash.Add(LuaMetaFingerprint::GeneratorVersion);
+        hash.Add(static_cast<AZ::u64>(SymbolDatabase::Version));
+        hash.Add(m_engineVersion);
+        for (const AZStd::string& gemName : m_gemNames)
+        {
+            hash.Add(gemName);
+        }
+        hash.Add(m_settings.m_sharded);
+        hash.Add(m_settings.m_symbolDatabase);
+        for (const LuaMetaOutput& output : m_outputs)
+        {
+            hash.Add(output.m_name);
+            hash.Add(output.m_hash);
+        }
+        return hash.Get();
+    }
+
+    AZStd::vector<AZStd::string> LuaMetaGenerator::GetCacheFiles() const
+    {
+        AZStd::vector<AZStd::string> files;
+        files.reserve(m_outputs.size() + 4);
+        files.push_back(ConfigFileName);
+        for (const LuaMetaOutput& output : m_outputs)
+        {
+            files.push_back(AZStd::string::format("%s/%s.lua", LibraryFolderName, output.m_name.c_str()));
+        }
+        if (m_settings.m_sharded)
+        {
+            files.push_back(IndexFileName);
+        }
+        if (m_settings.m_symbolDatabase)
+        {
+            files.push_back(SymbolDatabaseFileName);
+        }
+        // written last, marks a complete entry
+        files.push_back(FingerprintFileName);
+        return files;
+    }
+
+    void LuaMetaGenerator::GenerateAsync()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_completeMutex);
+            m_complete = false;
+        }
+
+        AZ::Job* job = AZ::CreateJobFunction([this]()
+            {
+                const bool success = Generate();
+                SetComplete();
+                // queued after SetComplete() so listeners see the generator as complete, the events are delivered on the
+                // next tick. Only the bus is used here, the generator may already be destroyed.
+                LuaVSCodeNotificationBus::QueueBroadcast(&LuaVSCodeNotifications::OnMetaGenerationComplete, success);
+            }, true);
+        job->Start();
+    }
+
+    bool LuaMetaGenerator::Wait(AZ::u32 timeoutMilliseconds)
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_completeMutex);
+        return m_completeCondition.wait_for(lock, AZStd::chrono::milliseconds(timeoutMilliseconds), [this]() { return m_complete; });
+    }
+
+    LuaMetaGenerationStats LuaMetaGenerator::GetStats() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+        return m_stats;
+    }
+
+    bool LuaMetaGenerator::IsComplete() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_completeMutex);
+        return m_complete;
+    }
+
+    float LuaMetaGenerator::GetProgress() const
+    {
+        const size_t itemsTotal = m_itemsTotal;
+        if (itemsTotal == 0)
+        {
+            return IsComplete() ? 1.0f : 0.0f;
+        }
+        return static_cast<float>(m_itemsWritten) / static_cast<float>(itemsTotal);
+    }
+
+    void LuaMetaGenerator::SetComplete()
+    {
+        // the destructor may run as soon as the lock is released, so notify while holding it
+        // and touch nothing of the generator afterwards
+        AZStd::lock_guard<AZStd::mutex> lock(m_completeMutex);
+        m_complete = true;
+        m_completeCondition.notify_all();
+    }
+
+    void LuaMetaGenerator::WriteConfig()
+    {
+        LuaMetaWriter luaConfigFile(64);
+        luaConfigFile.Append(R"({"name" : "O3DE", "words" : ["o3de","ebus"]})");
+        luaConfigFile.WriteToFile(m_configFilePath.c_str());
+    }
+
+    void LuaMetaGenerator::WriteWorkspaceConfig()
+    {
+        AZ_PROFILE_FUNCTION(LuaVSCode);
+        if (m_workspaceConfigFilePath.empty())
+        {
+            return;
+        }
+
+        if (AZ::IO::SystemFile::Exists(m_workspaceConfigFilePath.c_str()))
+        {
+            auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(m_workspaceConfigFilePath.c_str());
+            const bool generated = readResult.IsSuccess() && readResult.GetValue().IsObject() &&
+                readResult.GetValue().HasMember(WorkspaceConfigGeneratorKey);
+            if (!generated)
+            {
+                AZ_TracePrintf("LuaVSCode", "Leaving '%s' alone, it was not generated. Add \"workspace.library\": [\"%s\"] to it "
+                    "or delete it to have it generated.\n", m_workspaceConfigFilePath.c_str(),
+                    m_libraryPath.LexicallyRelative(m_projectPath).StringAsPosix().c_str());
+                return;
+            }
+        }
+
+        // the language server silently skips files over the preload size and stops loading after the file count,
+        // either way completions for whole sections disappear
+        AZ::u64 largestFileSize = 0;
+        for (const LuaMetaOutput& output : m_outputs)
+        {
+            largestFileSize = AZStd::max<AZ::u64>(largestFileSize, AZ::IO::SystemFile::Length(output.m_filePath.c_str()));
+        }
+        // headroom so the limit does not have to follow every small change in the reflection
+        const AZ::u64 preloadFileSizeKB = AZStd::max(DefaultPreloadFileSizeKB, (largestFileSize + largestFileSize / 4) / 1024 + 1);
+        const AZ::u64 maxPreload = DefaultMaxPreload + m_outputs.size();
+
+        rapidjson::Document document;
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+        auto addString = [&allocator](rapidjson::Value& target, AZStd::string_view value)
+        {
+            target.PushBack(rapidjson::Value(value.data(), static_cast<rapidjson::SizeType>(value.size()), allocator), allocator);
+        };
+
+        document.AddMember("$schema", "https://raw.githubusercontent.com/LuaLS/vscode-lua/master/setting/schema.json", allocator);
+        document.AddMember(rapidjson::StringRef(WorkspaceConfigGeneratorKey), rapidjson::StringRef(WorkspaceConfigGenerator), allocator);
+        document.AddMember("runtime.version", "Lua 5.4", allocator);
+
+        rapidjson::Value library(rapidjson::kArrayType);
+        addString(library, m_libraryPath.LexicallyRelative(m_projectPath).StringAsPosix());
+        document.AddMember("workspace.library", library, allocator);
+        document.AddMember("workspace.checkThirdParty", false, allocator);
+        document.AddMember("workspace.preloadFileSize", rapidjson::Value(preloadFileSizeKB), allocator);
+        document.AddMember("workspace.maxPreload", rapidjson::Value(maxPreload), allocator);
+
+        rapidjson::Value ignoreDirs(rapidjson::kArrayType);
+        for (const char* ignoreDir : WorkspaceIgnoreDirs)
+        {
+            addString(ignoreDirs, ignoreDir);
+        }
+        document.AddMember("workspace.ignoreDir", ignoreDirs, allocator);
+
+        const bool written = WriteJsonFile(document, m_workspaceConfigFilePath.c_str());
+        AZ_Warning("LuaVSCode", written, "Failed to write language server config '%s'", m_workspaceConfigFilePath.c_str());
+    }
+
+    bool LuaMetaGenerator::WriteOutput(LuaMetaOutput& output)
+    {
+        output.m_writer.Clear();
+        output.m_writer.Append("---@meta\n");
+        for (const auto& chunk : output.m_chunks)
+        {
+            output.m_writer.Append(chunk);
+        }
+
+        const size_t writeCount = output.m_writer.GetWriteCount();
+        const size_t unchangedCount = output.m_writer.GetUnchangedCount();
+        const bool written = output.m_writer.WriteToFile(output.m_filePath.c_str());
+        output.m_unchanged = output.m_writer.GetUnchangedCount() != unchangedCount;
+        output.m_writeCalls = output.m_writer.GetWriteCount() - writeCount;
+        output.m_bytesWritten = written && !output.m_unchanged ? output.m_writer.GetSize() : 0;
+        return written;
+    }
+
+    bool LuaMetaGenerator::WriteIndex()
+    {
+        // maps every class and EBus to the shard that declares it, so tools can open a single file for a symbol
+        rapidjson::Document document;
+        document.SetObject();
+        rapidjson::Value classes(rapidjson::kObjectType);
+        rapidjson::Value ebuses(rapidjson::kObjectType);
+        for (const LuaMetaOutput& output : m_outputs)
+        {
+            if (output.m_section != LuaMetaSection::Classes && output.m_section != LuaMetaSection::EBuses)
+            {
+                continue;
+            }
+
+            const AZStd::string shardPath = AZStd::string::format("library/%s.lua", output.m_name.c_str());
+            rapidjson::Value& symbols = output.m_section == LuaMetaSection::Classes ? classes : ebuses;
+            for (size_t itemIndex : output.m_items)
+            {
+                const AZStd::string& name = output.m_section == LuaMetaSection::Classes
+                    ? m_symbols.m_classes[itemIndex].m_name
+                    : m_symbols.m_ebuses[itemIndex].m_name;
+                symbols.AddMember(
+                    rapidjson::Value(name.c_str(), static_cast<rapidjson::SizeType>(name.size()), document.GetAllocator()),
+                    rapidjson::Value(shardPath.c_str(), static_cast<rapidjson::SizeType>(shardPath.size()), document.GetAllocator()),
+                    document.GetAllocator());
+            }
+        }
+        document.AddMember("classes", classes, document.GetAllocator());
+        document.AddMember("ebuses", ebuses, document.GetAllocator());
+
+        const bool written = WriteJsonFile(document, m_indexFilePath.c_str());
+        AZ_Warning("LuaVSCode", written, "Failed to write meta index '%s'", m_indexFilePath.c_str());
+        return written;
+    }
+
+    void LuaMetaGenerator::RemoveStaleFiles(const LuaMetaFingerprint& previousFingerprint, bool hasPreviousFingerprint)
+    {
+        auto isOutput = [this](const AZStd::string& name)
+        {
+            return AZStd::any_of(m_outputs.begin(), m_outputs.end(), [&name](const LuaMetaOutput& output) { return output.m_name == name; });
+        };
+
+        AZStd::vector<AZ::IO::FixedMaxPath> staleFiles;
+        if (hasPreviousFingerprint)
+        {
+            // shards that were emptied or merged, and the files of the other layout after the mode changed
+            for (const auto& previousOutput : previousFingerprint.m_outputs)
+            {
+                if (!isOutput(previousOutput.first))
+                {
+                    staleFiles.push_back(m_libraryPath / AZStd::string::format("%s.lua", previousOutput.first.c_str()));
+                }
+            }
+        }
+        else
+        {
+            // nothing recorded what an older generator wrote, sweep both layouts
+            for (LuaMetaSection section : { LuaMetaSection::Classes, LuaMetaSection::EBuses })
+            {
+                const AZStd::string sectionName = GetSectionName(section);
+                if (!isOutput(sectionName))
+                {
+                    staleFiles.push_back(m_libraryPath / AZStd::string::format("%s.lua", sectionName.c_str()));
+                }
+
+                const AZ::IO::FixedMaxPath shardFilter = m_libraryPath / sectionName / "*.lua";
+                AZ::IO::SystemFile::FindFiles(shardFilter.c_str(), [this, &sectionName, &isOutput, &staleFiles](const char* fileName, bool isFile)
+                    {
+                        const AZ::IO::PathView shardName = AZ::IO::PathView(fileName).Stem();
+                        const AZStd::string name = AZStd::string::format("%s/%.*s", sectionName.c_str(), AZ_STRING_ARG(shardName.Native()));
+                        if (isFile && !isOutput(name))
+                        {
+                            staleFiles.push_back(m_libraryPath / sectionName / fileName);
+                        }
+                        return true;
+                    });
+            }
+        }
+
+        if (!m_settings.m_sharded)
+        {
+            staleFiles.push_back(m_indexFilePath);
+        }
+        if (!m_settings.m_symbolDatabase)
+        {
+            staleFiles.push_back(m_symbolDatabaseFilePath);
+        }
+
+        for (const auto& staleFile : staleFiles)
+        {
+            if (AZ::IO::SystemFile::Exists(staleFile.c_str()))
+            {
+                AZ_Warning("LuaVSCode", AZ::IO::SystemFile::Delete(staleFile.c_str()), "Failed to remove stale meta file '%s'", staleFile.c_str());
+            }
+        }
+    }
+
+    void LuaMetaGenerator::RenderItems(const LuaMetaOutput& output, size_t begin, size_t end, LuaMetaWriter& writer, LuaMetaScratch& scratch)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const size_t itemIndex = output.m_items[i];
+            switch (output.m_section)
+            {
+            case LuaMetaSection::Classes:
+                RenderClass(m_symbols.m_classes[itemIndex], writer, scratch);
+                break;
+            case LuaMetaSection::EBuses:
+                RenderEBus(m_symbols.m_ebuses[itemIndex], writer, scratch);
+                break;
+            case LuaMetaSection::Properties:
+                writer.AppendFormat("---@class %s\n", m_symbols.m_globalProperties[itemIndex].c_str());
+                break;
+            case LuaMetaSection::Functions:
+                WriteLuaBehaviorMethod(m_symbols.m_globalFunctions[itemIndex], writer, nullptr, scratch);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void LuaMetaGenerator::RenderClass(const LuaMetaClass& luaClass, LuaMetaWriter& writer, LuaMetaScratch& scratch)
+    {
+        writer.AppendFormat("\n---@class %s\n", luaClass.m_name.c_str());
+
+        for (const auto& luaProperty : luaClass.m_properties)
+        {
+            writer.AppendFormat("---@field %s\n", luaProperty.c_str());
+        }
+
+        writer.AppendFormat("%s = {}\n", luaClass.m_name.c_str());
+
+        for (const auto& luaMethod : luaClass.m_methods)
+        {
+            WriteLuaBehaviorMethod(luaMethod, writer, luaClass.m_name.c_str(), scratch);
+        }
+    }
+
+    void LuaMetaGenerator::RenderEBus(const LuaMetaEBus& ebus, LuaMetaWriter& writer, LuaMetaScratch& scratch)
+    {
+        writer.AppendFormat("---@class %s\n", ebus.m_name.c_str());
+
+        if (!ebus.m_hasSenders)
+        {
+            writer.AppendFormat("%s = {}\n", ebus.m_name.c_str());
+        }
+        else if (ebus.m_canBroadcast)
+        {
+            writer.AppendFormat("%s = { Event = {}, Broadcast = {} }\n", ebus.m_name.c_str());
+        }
+        else
+        {
+            writer.AppendFormat("%s = { Event = {}}\n", ebus.m_name.c_str());
+        }
+
+        for (const auto& sender : ebus.m_senders)
+        {
+            WriteLuaBehaviorMethod(sender, writer, ebus.m_name.c_str(), scratch);
+        }
+    }
+} // namespace LuaVSCode
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <AzCore/Debug/Budget.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzToolsFramework/Script/LuaSymbolsReporterBus.h>
+#include <LuaVSCode/LuaVSCodeBus.h>
+#include "LuaMetaCache.h"
+#include "LuaMetaSymbols.h"
+#include "LuaMetaWriter.h"
+#include "LuaSymbolDatabaseWriter.h"
+
+namespace AZ
+{
+    class BehaviorContext;
+}
+
+AZ_DECLARE_BUDGET(LuaVSCode);
+
+namespace LuaVSCode
+{
+    //! The kinds of symbol written to the meta library
+    enum class LuaMetaSection : AZ::u8
+    {
+        Classes,
+        EBuses,
+        Properties,
+        Functions,
+        Count
+    };
+
+    constexpr size_t LuaMetaSectionCount = static_cast<size_t>(LuaMetaSection::Count);
+
+    //! Hash of the reflected symbols that go into each meta file, keyed by the file name relative to the library folder.
+    //! Stored next to config.json so unchanged files are not rewritten on the next launch.
+    struct LuaMetaFingerprint
+    {
+        //! Bump whenever the generated output format changes so every file is rebuilt
+        static constexpr AZ::u64 GeneratorVersion = 2;
+
+        AZ::u64 m_version = GeneratorVersion;
+        AZStd::unordered_map<AZStd::string, AZ::u64> m_outputs;
+
+        //! Returns 0 for a file that is not in the fingerprint
+        AZ::u64 GetOutput(const AZStd::string& name) const;
+        void SetOutput(const AZStd::string& name, AZ::u64 hash) { m_outputs[name] = hash; }
+
+        bool Load(const char* filePath);
+        bool Save(const char* filePath) const;
+    };
+
+    //! Names reflected and removed through AZ::BehaviorContextBus after the symbol reporter built its lists.
+    //! The reporter is not guaranteed to rebuild them, CaptureSymbols() applies these changes on top.
+    struct LuaMetaReflectionChanges
+    {
+        //! Reflected names per section, in the order they were added
+        AZStd::vector<AZStd::string> m_added[LuaMetaSectionCount];
+        //! Removed names per section, the reporter may still list them
+        AZStd::unordered_set<AZStd::string> m_removed[LuaMetaSectionCount];
+
+        void Add(LuaMetaSection section, AZStd::string_view name);
+        void Remove(LuaMetaSection section, AZStd::string_view name);
+
+        bool IsRemoved(LuaMetaSection section, AZStd::string_view name) const;
+    };
+
+    //! How much of the reflection goes into the meta library
+    enum class LuaMetaProfile : AZ::u8
+    {
+        //! Everything the symbol reporter lists, with tooltips
+        Full,
+        //! Skips symbols reflected with ExcludeFrom List or Documentation and drops tooltips, for smaller files
+        Lean
+    };
+
+    //! Generator options read from the settings registry under /O3DE/LuaVSCode/Meta
+    struct LuaMetaGeneratorSettings
+    {
+        LuaMetaProfile m_profile = LuaMetaProfile::Full;
+
+        //! Wildcard patterns matched against class, EBus and global names and their Category attribute, which gems
+        //! usually set to their own name. When m_include is not empty only matching symbols are written,
+        //! symbols matching m_exclude are never written.
+        AZStd::vector<AZStd::string> m_include;
+        AZStd::vector<AZStd::string> m_exclude;
+
+        //! Split classes and EBuses into one file per name prefix instead of one file each
+        bool m_sharded = false;
+
+        //! Start generating when the editor system component activates, the headless generator turns this off
+        bool m_generateOnActivate = true;
+
+        //! Also write symbols.bin, see LuaVSCode/LuaSymbolDatabase.h
+        bool m_symbolDatabase = true;
+
+        //! Also write .luarc.json to the project root so the Lua language server loads the whole library,
+        //! an existing file that was not written by the generator is left alone
+        bool m_workspaceConfig = true;
+
+        //! Local or shared folder generated meta is cached in, see LuaMetaCache. Empty disables the cache.
+        AZStd::string m_cachePath;
+
+        void Load();
+
+        //! False if the include and exclude patterns filter out a symbol with this name and category
+        bool IsIncluded(AZStd::string_view name, AZStd::string_view category) const;
+    };
+
+    //! One file of the meta library and the symbols that go into it
+    struct LuaMetaOutput
+    {
+        LuaMetaSection m_section = LuaMetaSection::Classes;
+        //! Path relative to the library folder without the extension, "classes" or "classes/editor"
+        AZStd::string m_name;
+        //! Indices into the snapshot list for m_section, in BehaviorContext order
+        AZStd::vector<size_t> m_items;
+        AZ::u64 m_hash = 0;
+        AZ::IO::FixedMaxPath m_filePath;
+        bool m_stale = false;
+        bool m_written = false;
+        //! m_written without touching the file because it already held the same bytes
+        bool m_unchanged = false;
+        size_t m_bytesWritten = 0;
+        size_t m_writeCalls = 0;
+
+        // kept between generations so their storage is reused
+        AZStd::vector<LuaMetaWriter> m_chunks;
+        LuaMetaWriter m_writer;
+    };
+
+    //! Formatting buffers owned by a single work item, so work items can render concurrently
+    struct LuaMetaScratch
+    {
+        AZStd::string m_params;
+    };
+
+    //! Writes the Lua language server meta library for everything reflected to Lua.
+    //! CaptureSymbols() must run on the main thread, the rest only reads the captured snapshot.
+    class LuaMetaGenerator
+    {
+    public:
+        ~LuaMetaGenerator();
+
+        //! Copies the reflected classes, EBuses and globals out of the BehaviorContext, with the reflection changes
+        //! the symbol reporter may not list yet
+        bool CaptureSymbols(const LuaMetaReflectionChanges& reflectionChanges = {});
+
+        //! The capture part of CaptureSymbols() for the lists of a given reporter, filtered with the current settings.
+        //! Does not resolve the output paths or load the settings.
+        void CaptureSymbols(AZ::BehaviorContext& behaviorContext, AzToolsFramework::Script::LuaSymbolsReporterRequests& reporter,
+            const LuaMetaReflectionChanges& reflectionChanges);
+
+        //! Replaces the snapshot with symbols that were not captured from the BehaviorContext, for tools and benchmarks.
+        //! Call SetOutputPath() and SetSettings() too, those are otherwise set by CaptureSymbols().
+        void SetSymbols(LuaMetaSymbols&& symbols);
+
+        //! Folder the meta library is written to, the project's scripts/meta/3rd/o3de by default
+        void SetOutputPath(AZ::IO::PathView metaPath);
+
+        //! Folder the .luarc.json workspace config is written to, CaptureSymbols() sets the project root. None is written without it.
+        void SetProjectPath(AZ::IO::PathView projectPath);
+
+        void SetSettings(const LuaMetaGeneratorSettings& settings);
+
+        //! Regenerates the meta files whose reflected symbols changed since the last run, returns false if a file could not be written
+        bool Generate();
+
+        //! Runs Generate() as a job, CaptureSymbols() must have been called first.
+        //! OnMetaGenerationComplete is queued once the job is done with the generator.
+        void GenerateAsync();
+
+        //! Blocks until a running GenerateAsync() job has exited, returns false on timeout
+        bool Wait(AZ::u32 timeoutMilliseconds);
+
+        //! True once the GenerateAsync() job has exited and the generator can be reused or destroyed
+        bool IsComplete() const;
+        float GetProgress() const;
+
+        const LuaMetaSymbols& GetSymbols() const { return m_symbols; }
+
+        const AZStd::vector<LuaMetaOutput>& GetOutputs() const { return m_outputs; }
+
+        //! Counters and timings of the last capture and generation, safe to call while a generation runs
+        LuaMetaGenerationStats GetStats() const;
+
+        static const char* GetSectionName(LuaMetaSection section);
+
+    private:
+        void ResolvePaths();
+        //! Engine version and loaded gems, part of the cache key
+        void CaptureEnvironment();
+
+        //! Splits the snapshot into m_outputs and hashes each of them
+        void BuildOutputs();
+        LuaMetaOutput& AddOutput(size_t& outputCount, LuaMetaSection section, const AZStd::string& name);
+        void AddShardedOutputs(size_t& outputCount, LuaMetaSection section, const AZStd::vector<AZStd::string_view>& names);
+
+        //! Renders and writes every stale output, the symbol database and the shard index
+        bool WriteStaleOutputs(bool writeSymbolDatabase, LuaMetaGenerationStats& stats);
+
+        AZ::u64 GetCacheKey() const;
+        //! Files of a cache entry relative to the meta folder
+        AZStd::vector<AZStd::string> GetCacheFiles() const;
+
+        void WriteConfig();
+        //! Sizes the language server limits to the library, after the outputs are on disk
+        void WriteWorkspaceConfig();
+        bool WriteOutput(LuaMetaOutput& output);
+        bool WriteIndex();
+        void RemoveStaleFiles(const LuaMetaFingerprint& previousFingerprint, bool hasPreviousFingerprint);
+
+        // render output.m_items[begin, end), called concurrently for different ranges
+        void RenderItems(const LuaMetaOutput& output, size_t begin, size_t end, LuaMetaWriter& writer, LuaMetaScratch& scratch);
+        void RenderClass(const LuaMetaClass& luaClass, LuaMetaWriter& writer, LuaMetaScratch& scratch);
+        void RenderEBus(const LuaMetaEBus& ebus, LuaMetaWriter& writer, LuaMetaScratch& scratch);
+
+        // last use of the generator by the GenerateAsync() job, it may be destroyed right after it
+        void SetComplete();
+
+        LuaMetaSymbols m_symbols;
+        LuaMetaGeneratorSettings m_settings;
+
+        AZStd::string m_engineVersion;
+        AZStd::vector<AZStd::string> m_gemNames;
+        LuaMetaCache m_cache;
+
+        // resolved on the main thread, the FileIO aliases are not safe to use from the job
+        AZ::IO::FixedMaxPath m_metaPath;
+        AZ::IO::FixedMaxPath m_configFilePath;
+        AZ::IO::FixedMaxPath m_fingerprintFilePath;
+        AZ::IO::FixedMaxPath m_indexFilePath;
+        AZ::IO::FixedMaxPath m_symbolDatabaseFilePath;
+        AZ::IO::FixedMaxPath m_libraryPath;
+        // empty unless captured from a project, tools that set their own output path get no workspace config
+        AZ::IO::FixedMaxPath m_projectPath;
+        AZ::IO::FixedMaxPath m_workspaceConfigFilePath;
+
+        // rebuilt by every generation, outputs in the same position keep their buffers
+        AZStd::vector<LuaMetaOutput> m_outputs;
+        LuaSymbolDatabaseWriter m_symbolDatabaseWriter;
+
+        // what the last successful generation wrote, loaded from the fingerprint file on the first one
+        LuaMetaFingerprint m_lastFingerprint;
+        bool m_hasLastFingerprint = false;
+        LuaMetaWriter m_symbolDatabaseOutput;
+
+        // the capture fields are set by CaptureSymbols(), the rest when a generation finishes
+        mutable AZStd::mutex m_statsMutex;
+        LuaMetaGenerationStats m_stats;
+
+        AZStd::atomic<size_t> m_itemsWritten{ 0 };
+        AZStd::atomic<size_t> m_itemsTotal{ 0 };
+
+        mutable AZStd::mutex m_completeMutex;
+        AZStd::condition_variable m_completeCondition;
+        bool m_complete = true;
+    };
+} // namespace LuaVSCode
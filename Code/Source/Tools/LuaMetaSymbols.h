@@ -0,0 +1,106 @@
+#pragma once
+
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace LuaVSCode
+{
+    //! How a method is called from Lua, which decides the table it is written into
+    enum class LuaMetaMethodKind : AZ::u8
+    {
+        Function,   //!< Class.Method(...) or a global Method(...)
+        Event,      //!< Bus.Event.Method(...)
+        Broadcast   //!< Bus.Broadcast.Method(...)
+    };
+
+    //! Stores each distinct string once. The views it returns stay valid until the pool is cleared or destroyed.
+    class LuaMetaStringPool
+    {
+    public:
+        LuaMetaStringPool() = default;
+        LuaMetaStringPool(LuaMetaStringPool&&) = default;
+        LuaMetaStringPool& operator=(LuaMetaStringPool&&) = default;
+
+        // the index holds views into m_strings, a copy would point at the source pool
+        LuaMetaStringPool(const LuaMetaStringPool&) = delete;
+        LuaMetaStringPool& operator=(const LuaMetaStringPool&) = delete;
+
+        AZStd::string_view Intern(AZStd::string_view value)
+        {
+            if (auto itr = m_index.find(value); itr != m_index.end())
+            {
+                return *itr;
+            }
+            // deque never relocates existing elements so earlier views stay valid
+            m_strings.emplace_back(value);
+            AZStd::string_view interned = m_strings.back();
+            m_index.insert(interned);
+            return interned;
+        }
+
+        void Clear()
+        {
+            m_index.clear();
+            m_strings.clear();
+        }
+
+    private:
+        AZStd::deque<AZStd::string> m_strings;
+        AZStd::unordered_set<AZStd::string_view> m_index;
+    };
+
+    struct LuaMetaParameter
+    {
+        //! Interned in LuaMetaSymbols::m_typeNames
+        AZStd::string_view m_name;
+        //! Interned in LuaMetaSymbols::m_tooltips, empty when the argument has none
+        AZStd::string_view m_tooltip;
+    };
+
+    struct LuaMetaMethod
+    {
+        AZStd::string m_name;
+        LuaMetaMethodKind m_kind = LuaMetaMethodKind::Function;
+        //! false when the method was not found in the BehaviorContext and only m_debugArgumentInfo is known
+        bool m_hasSignature = false;
+        AZStd::vector<LuaMetaParameter> m_parameters;
+        //! Lua type name of the result interned in LuaMetaSymbols::m_typeNames, empty for void
+        AZStd::string_view m_result;
+        AZStd::string m_debugArgumentInfo;
+    };
+
+    struct LuaMetaClass
+    {
+        AZStd::string m_name;
+        AZ::Uuid m_typeId = AZ::Uuid::CreateNull();
+        AZStd::vector<AZStd::string> m_properties;
+        AZStd::vector<LuaMetaMethod> m_methods;
+    };
+
+    struct LuaMetaEBus
+    {
+        AZStd::string m_name;
+        bool m_hasSenders = false;
+        bool m_canBroadcast = false;
+        //! Events and broadcasts in BehaviorContext order
+        AZStd::vector<LuaMetaMethod> m_senders;
+    };
+
+    //! Plain copy of everything the meta library needs from the BehaviorContext.
+    //! Captured on the main thread so the files can be written from a job without touching reflection.
+    struct LuaMetaSymbols
+    {
+        AZStd::vector<LuaMetaClass> m_classes;
+        AZStd::vector<LuaMetaEBus> m_ebuses;
+        AZStd::vector<AZStd::string> m_globalProperties;
+        AZStd::vector<LuaMetaMethod> m_globalFunctions;
+
+        //! Lua type names referenced by parameters and results
+        LuaMetaStringPool m_typeNames;
+        //! Parameter tooltips, many methods share the same ones
+        LuaMetaStringPool m_tooltips;
+    };
+} // namespace LuaVSCode
@@ -0,0 +1,162 @@
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/string/string.h>
+#include "LuaMetaWriter.h"
+
+namespace LuaVSCode
+{
+    LuaMetaWriter::LuaMetaWriter(size_t capacity)
+    {
+        Reserve(capacity);
+    }
+
+    void LuaMetaWriter::Reserve(size_t capacity)
+    {
+        if (capacity > m_buffer.size())
+        {
+            m_buffer.resize(capacity);
+        }
+    }
+
+    void LuaMetaWriter::Append(AZStd::string_view text)
+    {
+        if (text.empty())
+        {
+            return;
+        }
+
+        if (m_size + text.size() > m_buffer.size())
+        {
+            Reserve(AZStd::max(m_size + text.size(), m_buffer.size() * 2));
+        }
+        memcpy(m_buffer.data() + m_size, text.data(), text.size());
+        m_size += text.size();
+    }
+
+    void LuaMetaWriter::Append(const LuaMetaWriter& other)
+    {
+        Append(other.GetView());
+    }
+
+    void LuaMetaWriter::AppendFormat(const char* format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        AppendFormatV(format, args);
+        va_end(args);
+    }
+
+    void LuaMetaWriter::AppendFormatV(const char* format, va_list args)
+    {
+        // format in place, only when the line does not fit is the buffer grown and the line formatted again
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+
+        const size_t available = m_buffer.size() - m_size;
+        const int length = azvsnprintf(m_buffer.data() + m_size, available, format, args);
+        if (length < 0)
+        {
+            va_end(argsCopy);
+            return;
+        }
+
+        // vsnprintf needs room for the terminator even though it is not kept
+        if (static_cast<size_t>(length) >= available)
+        {
+            Reserve(AZStd::max(m_size + length + 1, m_buffer.size() * 2));
+            azvsnprintf(m_buffer.data() + m_size, m_buffer.size() - m_size, format, argsCopy);
+        }
+        va_end(argsCopy);
+
+        m_size += length;
+    }
+
+    void LuaMetaWriter::Clear()
+    {
+        m_size = 0;
+    }
+
+    bool LuaMetaWriter::ReadFromFile(const char* filePath)
+    {
+        m_size = 0;
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::OpenMode::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+
+        const size_t length = file.Length();
+        Reserve(length);
+        const bool success = file.Read(length, m_buffer.data()) == length;
+        file.Close();
+        m_size = success ? length : 0;
+        return success;
+    }
+
+    bool LuaMetaWriter::MatchesFile(const char* filePath) const
+    {
+        if (!AZ::IO::SystemFile::Exists(filePath) || AZ::IO::SystemFile::Length(filePath) != m_size)
+        {
+            return false;
+        }
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::OpenMode::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+
+        // compared block by block so a mismatch near the start does not read the whole file
+        AZStd::vector<char> block(AZStd::min(m_size, CompareBlockSize));
+        bool matches = true;
+        for (size_t offset = 0; offset < m_size && matches;)
+        {
+            const size_t readSize = AZStd::min(m_size - offset, CompareBlockSize);
+            matches = file.Read(readSize, block.data()) == readSize && memcmp(block.data(), m_buffer.data() + offset, readSize) == 0;
+            offset += readSize;
+        }
+        file.Close();
+        return matches;
+    }
+
+    bool LuaMetaWriter::WriteToFile(const char* filePath)
+    {
+        // rewriting identical bytes still bumps the timestamp, which makes file watchers reindex the library
+        if (MatchesFile(filePath))
+        {
+            ++m_unchangedCount;
+            return true;
+        }
+
+        constexpr int openMode = AZ::IO::SystemFile::OpenMode::SF_OPEN_CREATE |
+            AZ::IO::SystemFile::OpenMode::SF_OPEN_WRITE_ONLY |
+            AZ::IO::SystemFile::OpenMode::SF_OPEN_CREATE_PATH;
+
+        // unique per write, processes on other machines may write the same file in a shared folder
+        const AZStd::string tempFilePath = AZStd::string::format("%s.%s.tmp", filePath,
+            AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str());
+        AZ::IO::SystemFile file;
+        if (!file.Open(tempFilePath.c_str(), openMode))
+        {
+            return false;
+        }
+
+        bool success = true;
+        for (size_t offset = 0; offset < m_size && success;)
+        {
+            const size_t writeSize = AZStd::min(m_size - offset, MaxWriteSize);
+            success = file.Write(m_buffer.data() + offset, writeSize) == writeSize;
+            offset += writeSize;
+            ++m_writeCount;
+        }
+        file.Close();
+
+        success = success && AZ::IO::SystemFile::Rename(tempFilePath.c_str(), filePath, true);
+        if (!success)
+        {
+            AZ::IO::SystemFile::Delete(tempFilePath.c_str());
+        }
+        return success;
+    }
+} // namespace LuaVSCode
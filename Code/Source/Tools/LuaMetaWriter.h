@@ -0,0 +1,63 @@
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+#include <stdarg.h>
+
+namespace LuaVSCode
+{
+    //! Append buffer for generated meta text.
+    //! Lines are formatted straight into reusable storage and the whole buffer is written to disk
+    //! with a single write instead of one write per line.
+    class LuaMetaWriter
+    {
+    public:
+        static constexpr size_t DefaultCapacity = 64 * 1024;
+
+        //! Largest single write issued by WriteToFile, bigger buffers are written in chunks of this size
+        static constexpr size_t MaxWriteSize = 256 * 1024 * 1024;
+
+        //! Size of the blocks MatchesFile reads the existing file in
+        static constexpr size_t CompareBlockSize = 64 * 1024;
+
+        explicit LuaMetaWriter(size_t capacity = DefaultCapacity);
+
+        void Append(AZStd::string_view text);
+        void Append(const LuaMetaWriter& other);
+        void AppendFormat(const char* format, ...) AZ_FORMAT_ATTRIBUTE(2, 3);
+        void AppendFormatV(const char* format, va_list args);
+
+        //! Empties the buffer but keeps its storage for the next generation
+        void Clear();
+        void Reserve(size_t capacity);
+
+        AZStd::string_view GetView() const { return { m_buffer.data(), m_size }; }
+        const char* GetData() const { return m_buffer.data(); }
+        size_t GetSize() const { return m_size; }
+
+        //! Replaces the contents of filePath with the buffer, returns false if the file could not be written.
+        //! A file that already holds the same bytes is left untouched so its timestamp does not change,
+        //! otherwise the buffer goes to a uniquely named temp file that is renamed over filePath so readers never see a partial file
+        //! and concurrent writers of the same file never share a temp file.
+        bool WriteToFile(const char* filePath);
+
+        //! Replaces the buffer with the contents of filePath, returns false if it could not be read
+        bool ReadFromFile(const char* filePath);
+
+        //! True if filePath exists and holds exactly the bytes in the buffer
+        bool MatchesFile(const char* filePath) const;
+
+        //! Number of file writes issued by this writer, for benchmarks and stats
+        size_t GetWriteCount() const { return m_writeCount; }
+
+        //! Number of WriteToFile calls skipped because the file was already up to date
+        size_t GetUnchangedCount() const { return m_unchangedCount; }
+
+    private:
+        AZStd::vector<char> m_buffer;
+        size_t m_size = 0;
+        size_t m_writeCount = 0;
+        size_t m_unchangedCount = 0;
+    };
+} // namespace LuaVSCode
@@ -0,0 +1,179 @@
+#include "LuaSymbolDatabaseWriter.h"
+
+namespace LuaVSCode
+{
+    namespace
+    {
+        // the reader maps records as they are laid out in memory
+        static_assert(sizeof(SymbolDatabase::Header) == 112, "Header layout changed, bump SymbolDatabase::Version");
+        static_assert(sizeof(SymbolDatabase::Method) == 36, "Method layout changed, bump SymbolDatabase::Version");
+        static_assert(sizeof(SymbolDatabase::Class) == 24, "Class layout changed, bump SymbolDatabase::Version");
+        static_assert(sizeof(SymbolDatabase::EBus) == 20, "EBus layout changed, bump SymbolDatabase::Version");
+
+        static_assert(static_cast<AZ::u8>(SymbolDatabase::MethodKind::Broadcast) == static_cast<AZ::u8>(LuaMetaMethodKind::Broadcast),
+            "SymbolDatabase::MethodKind mirrors LuaMetaMethodKind");
+
+        struct TableData
+        {
+            SymbolDatabase::Table m_table;
+            const void* m_records;
+            size_t m_count;
+        };
+    }
+
+    SymbolDatabase::StringRef LuaSymbolDatabaseWriter::AddString(AZStd::string_view value)
+    {
+        if (auto itr = m_stringRefs.find(value); itr != m_stringRefs.end())
+        {
+            return itr->second;
+        }
+
+        SymbolDatabase::StringRef stringRef{ static_cast<AZ::u32>(m_strings.size()), static_cast<AZ::u32>(value.size()) };
+        m_strings.insert(m_strings.end(), value.begin(), value.end());
+        m_stringRefs.emplace(value, stringRef);
+        return stringRef;
+    }
+
+    SymbolDatabase::Method LuaSymbolDatabaseWriter::AddMethod(const LuaMetaMethod& method)
+    {
+        SymbolDatabase::Method record;
+        record.m_name = AddString(method.m_name);
+        record.m_kind = static_cast<SymbolDatabase::MethodKind>(method.m_kind);
+        record.m_hasSignature = method.m_hasSignature ? 1 : 0;
+        record.m_parameters = { static_cast<AZ::u32>(m_parameters.size()), static_cast<AZ::u32>(method.m_parameters.size()) };
+        for (const auto& parameter : method.m_parameters)
+        {
+            m_parameters.push_back({ AddString(parameter.m_name), AddString(parameter.m_tooltip) });
+        }
+        record.m_result = AddString(method.m_result);
+        record.m_debugArgumentInfo = AddString(method.m_debugArgumentInfo);
+        return record;
+    }
+
+    template<typename T, typename GetName>
+    AZStd::vector<AZ::u32> LuaSymbolDatabaseWriter::BuildLookup(const AZStd::vector<T>& records, GetName getName) const
+    {
+        if (records.empty())
+        {
+            return {};
+        }
+
+        // at most half full so probe chains stay short
+        size_t bucketCount = 1;
+        while (bucketCount < records.size() * 2)
+        {
+            bucketCount <<= 1;
+        }
+        const size_t mask = bucketCount - 1;
+        AZStd::vector<AZ::u32> buckets(bucketCount, 0);
+        for (size_t recordIndex = 0; recordIndex < records.size(); ++recordIndex)
+        {
+            const SymbolDatabase::StringRef name = getName(records[recordIndex]);
+            size_t bucket = SymbolDatabase::HashName(AZStd::string_view(m_strings.data() + name.m_offset, name.m_size)) & mask;
+            while (buckets[bucket] != 0)
+            {
+                bucket = (bucket + 1) & mask;
+            }
+            buckets[bucket] = static_cast<AZ::u32>(recordIndex + 1);
+        }
+        return buckets;
+    }
+
+    void LuaSymbolDatabaseWriter::Write(const LuaMetaSymbols& symbols, AZ::u64 fingerprint, LuaMetaWriter& output)
+    {
+        m_classes.clear();
+        m_ebuses.clear();
+        m_methods.clear();
+        m_parameters.clear();
+        m_propertyNames.clear();
+        m_globalProperties.clear();
+        m_globalFunctions.clear();
+        m_strings.clear();
+        m_stringRefs.clear();
+
+        m_classes.reserve(symbols.m_classes.size());
+        for (const auto& luaClass : symbols.m_classes)
+        {
+            SymbolDatabase::Class& record = m_classes.emplace_back();
+            record.m_name = AddString(luaClass.m_name);
+            record.m_properties = { static_cast<AZ::u32>(m_propertyNames.size()), static_cast<AZ::u32>(luaClass.m_properties.size()) };
+            for (const auto& luaProperty : luaClass.m_properties)
+            {
+                m_propertyNames.push_back(AddString(luaProperty));
+            }
+            record.m_methods = { static_cast<AZ::u32>(m_methods.size()), static_cast<AZ::u32>(luaClass.m_methods.size()) };
+            for (const auto& luaMethod : luaClass.m_methods)
+            {
+                m_methods.push_back(AddMethod(luaMethod));
+            }
+        }
+
+        m_ebuses.reserve(symbols.m_ebuses.size());
+        for (const auto& ebus : symbols.m_ebuses)
+        {
+            SymbolDatabase::EBus& record = m_ebuses.emplace_back();
+            record.m_name = AddString(ebus.m_name);
+            record.m_hasSenders = ebus.m_hasSenders ? 1 : 0;
+            record.m_canBroadcast = ebus.m_canBroadcast ? 1 : 0;
+            record.m_senders = { static_cast<AZ::u32>(m_methods.size()), static_cast<AZ::u32>(ebus.m_senders.size()) };
+            for (const auto& sender : ebus.m_senders)
+            {
+                m_methods.push_back(AddMethod(sender));
+            }
+        }
+
+        for (const auto& globalProperty : symbols.m_globalProperties)
+        {
+            m_globalProperties.push_back(AddString(globalProperty));
+        }
+        for (const auto& globalFunction : symbols.m_globalFunctions)
+        {
+            m_globalFunctions.push_back(AddMethod(globalFunction));
+        }
+
+        auto getName = [](const auto& record) { return record.m_name; };
+        const AZStd::vector<AZ::u32> classLookup = BuildLookup(m_classes, getName);
+        const AZStd::vector<AZ::u32> ebusLookup = BuildLookup(m_ebuses, getName);
+        const AZStd::vector<AZ::u32> globalPropertyLookup = BuildLookup(m_globalProperties, [](const SymbolDatabase::StringRef& record) { return record; });
+        const AZStd::vector<AZ::u32> globalFunctionLookup = BuildLookup(m_globalFunctions, getName);
+
+        using SymbolDatabase::Table;
+        const TableData tables[] = {
+            { Table::Classes, m_classes.data(), m_classes.size() },
+            { Table::EBuses, m_ebuses.data(), m_ebuses.size() },
+            { Table::Methods, m_methods.data(), m_methods.size() },
+            { Table::Parameters, m_parameters.data(), m_parameters.size() },
+            { Table::PropertyNames, m_propertyNames.data(), m_propertyNames.size() },
+            { Table::GlobalProperties, m_globalProperties.data(), m_globalProperties.size() },
+            { Table::GlobalFunctions, m_globalFunctions.data(), m_globalFunctions.size() },
+            { Table::ClassLookup, classLookup.data(), classLookup.size() },
+            { Table::EBusLookup, ebusLookup.data(), ebusLookup.size() },
+            { Table::GlobalPropertyLookup, globalPropertyLookup.data(), globalPropertyLookup.size() },
+            { Table::GlobalFunctionLookup, globalFunctionLookup.data(), globalFunctionLookup.size() },
+            { Table::Strings, m_strings.data(), m_strings.size() }
+        };
+
+        // lay the tables out first so the header can be written ahead of them
+        SymbolDatabase::Header header;
+        header.m_fingerprint = fingerprint;
+        size_t size = sizeof(header);
+        for (const TableData& table : tables)
+        {
+            size = AZ::SizeAlignUp(size, 4);
+            header.m_tables[static_cast<size_t>(table.m_table)] = { static_cast<AZ::u32>(size), static_cast<AZ::u32>(table.m_count) };
+            size += table.m_count * SymbolDatabase::LuaSymbolDatabaseView::GetRecordSize(table.m_table);
+        }
+
+        output.Clear();
+        output.Reserve(size);
+        output.Append(AZStd::string_view(reinterpret_cast<const char*>(&header), sizeof(header)));
+        for (const TableData& table : tables)
+        {
+            constexpr char padding[4] = {};
+            const SymbolDatabase::TableRef& tableRef = header.m_tables[static_cast<size_t>(table.m_table)];
+            output.Append(AZStd::string_view(padding, tableRef.m_offset - output.GetSize()));
+            output.Append(AZStd::string_view(reinterpret_cast<const char*>(table.m_records),
+                table.m_count * SymbolDatabase::LuaSymbolDatabaseView::GetRecordSize(table.m_table)));
+        }
+    }
+} // namespace LuaVSCode
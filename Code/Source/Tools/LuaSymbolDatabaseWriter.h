@@ -0,0 +1,37 @@
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <LuaVSCode/LuaSymbolDatabase.h>
+#include "LuaMetaSymbols.h"
+#include "LuaMetaWriter.h"
+
+namespace LuaVSCode
+{
+    //! Serializes a LuaMetaSymbols snapshot into the layout described in LuaSymbolDatabase.h
+    class LuaSymbolDatabaseWriter
+    {
+    public:
+        //! Replaces the contents of output with the database for symbols
+        void Write(const LuaMetaSymbols& symbols, AZ::u64 fingerprint, LuaMetaWriter& output);
+
+    private:
+        SymbolDatabase::StringRef AddString(AZStd::string_view value);
+        SymbolDatabase::Method AddMethod(const LuaMetaMethod& method);
+
+        template<typename T, typename GetName>
+        AZStd::vector<AZ::u32> BuildLookup(const AZStd::vector<T>& records, GetName getName) const;
+
+        AZStd::vector<SymbolDatabase::Class> m_classes;
+        AZStd::vector<SymbolDatabase::EBus> m_ebuses;
+        AZStd::vector<SymbolDatabase::Method> m_methods;
+        AZStd::vector<SymbolDatabase::Parameter> m_parameters;
+        AZStd::vector<SymbolDatabase::StringRef> m_propertyNames;
+        AZStd::vector<SymbolDatabase::StringRef> m_globalProperties;
+        AZStd::vector<SymbolDatabase::Method> m_globalFunctions;
+
+        AZStd::vector<char> m_strings;
+        // keys view the snapshot, which outlives a Write() call
+        AZStd::unordered_map<AZStd::string_view, SymbolDatabase::StringRef> m_stringRefs;
+    };
+} // namespace LuaVSCode
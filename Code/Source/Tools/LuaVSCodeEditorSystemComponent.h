@@ -1,9 +1,13 @@
 
 #pragma once
 
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzToolsFramework/API/ToolsApplicationAPI.h>
 
 #include <Clients/LuaVSCodeSystemComponent.h>
+#include "LuaMetaGenerator.h"
 
 namespace LuaVSCode
 {
@@ -11,6 +15,7 @@ namespace LuaVSCode
     class LuaVSCodeEditorSystemComponent
         : public LuaVSCodeSystemComponent
         , protected AzToolsFramework::EditorEvents::Bus::Handler
+        , protected AZ::BehaviorContextBus::Handler
     {
         using BaseSystemComponent = LuaVSCodeSystemComponent;
     public:
@@ -26,8 +31,39 @@ namespace LuaVSCode
         static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
         static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
 
+        // LuaVSCodeRequestBus
+        bool IsMetaGenerationComplete() const override;
+        float GetMetaGenerationProgress() const override;
+        bool WaitForMetaGeneration(AZ::u32 timeoutMilliseconds) override;
+        LuaMetaGenerationStats GetMetaGenerationStats() const override;
+
         // AZ::Component
         void Activate() override;
         void Deactivate() override;
+
+        // AZ::TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        // AZ::BehaviorContextBus
+        void OnAddGlobalMethod(const char* methodName, AZ::BehaviorMethod* method) override;
+        void OnRemoveGlobalMethod(const char* methodName, AZ::BehaviorMethod* method) override;
+        void OnAddGlobalProperty(const char* propertyName, AZ::BehaviorProperty* prop) override;
+        void OnRemoveGlobalProperty(const char* propertyName, AZ::BehaviorProperty* prop) override;
+        void OnAddClass(const char* className, AZ::BehaviorClass* behaviorClass) override;
+        void OnRemoveClass(const char* className, AZ::BehaviorClass* behaviorClass) override;
+        void OnAddEBus(const char* ebusName, AZ::BehaviorEBus* ebus) override;
+        void OnRemoveEBus(const char* ebusName, AZ::BehaviorEBus* ebus) override;
+
+        //! Schedules a regeneration once reflection has been quiet for a moment
+        void OnReflectionChanged();
+
+        AZStd::unique_ptr<LuaMetaGenerator> m_metaGenerator;
+
+        // every change since activation, the symbol reporter does not rebuild its lists so each capture needs all of them
+        LuaMetaReflectionChanges m_reflectionChanges;
+
+        // a module reflects many symbols at once, regeneration waits until the changes stop
+        bool m_reflectionChanged = false;
+        AZStd::chrono::steady_clock::time_point m_reflectionChangedTime;
     };
 } // namespace LuaVSCode
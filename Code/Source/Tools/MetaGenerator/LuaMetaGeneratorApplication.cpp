@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "LuaMetaGeneratorApplication.h"
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <Tools/LuaMetaGenerator.h>
+
+namespace LuaVSCode
+{
+    static const char* GetBuildTargetName()
+    {
+#if !defined(LY_CMAKE_TARGET)
+#error "LY_CMAKE_TARGET must be defined in order to add this source file to a CMake executable target"
+#endif
+        return LY_CMAKE_TARGET;
+    }
+
+    LuaMetaGeneratorApplication::LuaMetaGeneratorApplication(int* argc, char*** argv)
+        : AzToolsFramework::ToolsApplication(argc, argv)
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddBuildSystemTargetSpecialization(
+            *settingsRegistry, GetBuildTargetName());
+
+        // The LuaVSCode editor module is loaded with the other gems and generation is run once from GenerateMeta() instead.
+        // GenerateOnActivate is turned off by Registry/luavscode.luavscodemetagenerator.setreg, the gem registries are
+        // merged after this constructor so a value set here would be overwritten by luavscode.setreg.
+
+        // the streamer's hardware report would only add noise to the output of a command line tool
+        settingsRegistry->Set("/Amazon/AzCore/Streamer/ReportHardware", false);
+    }
+
+    bool LuaMetaGeneratorApplication::GenerateMeta()
+    {
+        const auto startTime = AZStd::chrono::steady_clock::now();
+
+        LuaMetaGenerator generator;
+        if (!generator.CaptureSymbols())
+        {
+            AZ_Error("LuaMetaGenerator", false, "Lua symbols are not available, is the LuaSymbolsReporter system component active?");
+            return false;
+        }
+
+        const LuaMetaSymbols& symbols = generator.GetSymbols();
+        const bool success = generator.Generate();
+
+        const auto duration = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - startTime);
+        AZ_TracePrintf("LuaMetaGenerator", "Generated meta for %zu classes and %zu EBuses in %lld ms\n",
+            symbols.m_classes.size(), symbols.m_ebuses.size(), static_cast<long long>(duration.count()));
+        return success;
+    }
+}
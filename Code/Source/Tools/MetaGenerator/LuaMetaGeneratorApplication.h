@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+#include <AzToolsFramework/Application/ToolsApplication.h>
+
+namespace LuaVSCode
+{
+    //! Minimal tools application that loads the project's builder gems so their BehaviorContext
+    //! reflection is available, without the Editor UI or a render device.
+    class LuaMetaGeneratorApplication final
+        : public AzToolsFramework::ToolsApplication
+    {
+    public:
+        explicit LuaMetaGeneratorApplication(int* argc, char*** argv);
+        ~LuaMetaGeneratorApplication() override = default;
+
+        //! Writes the meta library for the loaded project, returns false if it could not be written
+        bool GenerateMeta();
+    };
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <iostream>
+#include <sstream>
+#include "LuaMetaGeneratorApplication.h"
+
+//! exit code when the meta library could not be written, listed by usage()
+constexpr int COULD_NOT_WRITE_META = 1;
+
+//! display proper usage of the application
+void usage()
+{
+    std::stringstream ss;
+    ss <<
+        "LuaVSCodeMetaGenerator\n"
+        "Writes the Lua language server meta library for an O3DE project without starting the Editor.\n"
+        "\n"
+        "Usage:\n"
+        "   LuaVSCodeMetaGenerator --project-path=<project> [--verbose] [--regset=/O3DE/LuaVSCode/Meta/Sharded=true]\n"
+        "\n"
+        "Options:\n"
+        "   --project-path: the project to load gems from and write scripts/meta into\n"
+        "   --verbose: output debug info\n"
+        "   --regset: override any /O3DE/LuaVSCode/Meta setting\n"
+        "\n"
+        "Exit Codes:\n"
+        "   0 - success\n"
+        << "   " << COULD_NOT_WRITE_META << " - the meta library could not be written\n";
+
+    std::cerr << ss.str() << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    bool verbose = false;
+    for (int i = 0; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--verbose") == 0)
+        {
+            verbose = true;
+        }
+        else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-?") == 0)
+        {
+            usage();
+            return 0;
+        }
+    }
+
+    if (!verbose)
+    {
+        AZ::Debug::Trace::Instance().SetLogLevel(AZ::Debug::LogLevel::Errors);
+    }
+
+    LuaVSCode::LuaMetaGeneratorApplication app(&argc, &argv);
+    app.Start({}, {});
+    const bool success = app.GenerateMeta();
+    app.Stop();
+
+    return success ? 0 : COULD_NOT_WRITE_META;
+}
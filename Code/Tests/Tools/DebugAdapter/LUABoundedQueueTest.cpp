@@ -0,0 +1,115 @@
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+#include <AzTest/AzTest.h>
+#include <Tools/DebugAdapter/LUABoundedQueue.h>
+
+namespace LUADebugger
+{
+    class LUABoundedQueueTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    TEST_F(LUABoundedQueueTest, TryPop_Empty_Fails)
+    {
+        LUABoundedQueue<int, 4> queue;
+        int value = 7;
+        EXPECT_FALSE(queue.TryPop(value));
+        EXPECT_EQ(value, 7);
+    }
+
+    TEST_F(LUABoundedQueueTest, TryPush_TryPop_FirstInFirstOut)
+    {
+        LUABoundedQueue<int, 4> queue;
+        // more values than cells so the positions wrap around
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_TRUE(queue.TryPush(int(i)));
+            EXPECT_TRUE(queue.TryPush(int(i + 100)));
+
+            int value = -1;
+            ASSERT_TRUE(queue.TryPop(value));
+            EXPECT_EQ(value, i);
+            ASSERT_TRUE(queue.TryPop(value));
+            EXPECT_EQ(value, i + 100);
+        }
+    }
+
+    TEST_F(LUABoundedQueueTest, TryPush_Full_FailsWithoutTakingValue)
+    {
+        LUABoundedQueue<AZStd::string, 2> queue;
+        EXPECT_TRUE(queue.TryPush("first"));
+        EXPECT_TRUE(queue.TryPush("second"));
+
+        AZStd::string rejected = "third";
+        EXPECT_FALSE(queue.TryPush(AZStd::move(rejected)));
+        EXPECT_EQ(rejected, "third");
+
+        AZStd::string value;
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, "first");
+        EXPECT_TRUE(queue.TryPush(AZStd::move(rejected)));
+    }
+
+    TEST_F(LUABoundedQueueTest, TryPushTryPop_ConcurrentProducersAndConsumers_EveryValueOnce)
+    {
+        constexpr int ThreadCount = 4;
+        constexpr int ValuesPerThread = 10000;
+        LUABoundedQueue<int, 64> queue;
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int producer = 0; producer < ThreadCount; ++producer)
+        {
+            threads.emplace_back([&queue, producer]()
+                {
+                    for (int i = 0; i < ValuesPerThread; ++i)
+                    {
+                        while (!queue.TryPush(producer * ValuesPerThread + i))
+                        {
+                            AZStd::this_thread::yield();
+                        }
+                    }
+                });
+        }
+
+        AZStd::vector<AZStd::vector<int>> popped(ThreadCount);
+        for (int consumer = 0; consumer < ThreadCount; ++consumer)
+        {
+            threads.emplace_back([&queue, &values = popped[consumer]]()
+                {
+                    while (values.size() < ValuesPerThread)
+                    {
+                        int value = 0;
+                        if (queue.TryPop(value))
+                        {
+                            values.push_back(value);
+                        }
+                        else
+                        {
+                            AZStd::this_thread::yield();
+                        }
+                    }
+                });
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZStd::vector<int> seen(ThreadCount * ValuesPerThread, 0);
+        for (const AZStd::vector<int>& values : popped)
+        {
+            for (int value : values)
+            {
+                ASSERT_GE(value, 0);
+                ASSERT_LT(value, ThreadCount * ValuesPerThread);
+                ++seen[value];
+            }
+        }
+        EXPECT_EQ(AZStd::count(seen.begin(), seen.end(), 1), ThreadCount * ValuesPerThread);
+    }
+} // namespace LUADebugger
@@ -0,0 +1,124 @@
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <Tools/DebugAdapter/LUABreakpoints.h>
+
+namespace LUADebugger
+{
+    class LUABreakpointTableTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        const AZStd::string m_debugName = "@scripts/foo.lua";
+    };
+
+    TEST_F(LUABreakpointTableTest, SetLines_NewSource_AddsSortedUniqueLines)
+    {
+        LUABreakpointTable table;
+        const LUABreakpointTable::Changes changes = table.SetLines(m_debugName, { 12, 3, 7, 3 });
+
+        EXPECT_EQ(changes.m_added, AZStd::vector<int>({ 3, 7, 12 }));
+        EXPECT_TRUE(changes.m_removed.empty());
+        EXPECT_EQ(table.GetSources().at(m_debugName), AZStd::vector<int>({ 3, 7, 12 }));
+    }
+
+    TEST_F(LUABreakpointTableTest, SetLines_ChangedLines_ReturnsDifference)
+    {
+        LUABreakpointTable table;
+        table.SetLines(m_debugName, { 1, 3, 5 });
+        const LUABreakpointTable::Changes changes = table.SetLines(m_debugName, { 7, 3 });
+
+        EXPECT_EQ(changes.m_added, AZStd::vector<int>({ 7 }));
+        EXPECT_EQ(changes.m_removed, AZStd::vector<int>({ 1, 5 }));
+        EXPECT_EQ(table.Find(m_debugName, 1), nullptr);
+        EXPECT_NE(table.Find(m_debugName, 7), nullptr);
+    }
+
+    TEST_F(LUABreakpointTableTest, SetLines_SameLines_NoChanges)
+    {
+        LUABreakpointTable table;
+        table.SetLines(m_debugName, { 1, 3 });
+        EXPECT_TRUE(table.SetLines(m_debugName, { 3, 1 }).IsEmpty());
+    }
+
+    TEST_F(LUABreakpointTableTest, SetLines_KeptLine_KeepsIdAndVerified)
+    {
+        LUABreakpointTable table;
+        table.SetLines(m_debugName, { 3, 5 });
+        EXPECT_TRUE(table.SetVerified(m_debugName, 3, true));
+        const AZ::s64 id = table.Find(m_debugName, 3)->m_id;
+
+        table.SetLines(m_debugName, { 3, 9 });
+
+        const LUABreakpoint* kept = table.Find(m_debugName, 3);
+        ASSERT_NE(kept, nullptr);
+        EXPECT_EQ(kept->m_id, id);
+        EXPECT_TRUE(kept->m_verified);
+        EXPECT_FALSE(table.IsVerified(m_debugName, 9));
+    }
+
+    TEST_F(LUABreakpointTableTest, SetLines_LineAddedAgain_GetsNewId)
+    {
+        LUABreakpointTable table;
+        table.SetLines(m_debugName, { 3 });
+        const AZ::s64 id = table.Find(m_debugName, 3)->m_id;
+        table.SetLines(m_debugName, {});
+        table.SetLines(m_debugName, { 3 });
+
+        const LUABreakpoint* readded = table.Find(m_debugName, 3);
+        ASSERT_NE(readded, nullptr);
+        EXPECT_NE(readded->m_id, id);
+    }
+
+    TEST_F(LUABreakpointTableTest, SetLines_NoLines_RemovesSource)
+    {
+        LUABreakpointTable table;
+        table.SetLines(m_debugName, { 3 });
+        table.SetLines("@scripts/bar.lua", { 3 });
+        table.SetLines(m_debugName, {});
+
+        EXPECT_EQ(table.GetSources().count(m_debugName), 0);
+        EXPECT_EQ(table.GetSources().size(), 1);
+        // same line in another source is a different breakpoint
+        EXPECT_NE(table.Find("@scripts/bar.lua", 3), nullptr);
+    }
+
+    TEST_F(LUABreakpointTableTest, SetVerified_UnknownLine_Fails)
+    {
+        LUABreakpointTable table;
+        table.SetLines(m_debugName, { 3 });
+        EXPECT_FALSE(table.SetVerified(m_debugName, 4, true));
+        EXPECT_FALSE(table.SetVerified("@scripts/bar.lua", 3, true));
+    }
+
+    TEST_F(LUABreakpointTableTest, SetReported_KeptLine_StaysReported)
+    {
+        LUABreakpointTable table;
+        table.SetLines(m_debugName, { 3 });
+        EXPECT_FALSE(table.Find(m_debugName, 3)->m_reported);
+        EXPECT_TRUE(table.SetReported(m_debugName, 3));
+        EXPECT_FALSE(table.SetReported(m_debugName, 4));
+
+        table.SetLines(m_debugName, { 3, 5 });
+
+        EXPECT_TRUE(table.Find(m_debugName, 3)->m_reported);
+        // a new line is reported by the next response
+        EXPECT_FALSE(table.Find(m_debugName, 5)->m_reported);
+    }
+
+    TEST_F(LUABreakpointTableTest, ResetVerified_ReturnsOnlyVerified)
+    {
+        LUABreakpointTable table;
+        table.SetLines(m_debugName, { 3, 5 });
+        table.SetVerified(m_debugName, 5, true);
+        const AZ::s64 id = table.Find(m_debugName, 5)->m_id;
+
+        const auto reset = table.ResetVerified();
+
+        ASSERT_EQ(reset.size(), 1);
+        EXPECT_EQ(reset[0].first.m_debugName, m_debugName);
+        EXPECT_EQ(reset[0].first.m_line, 5);
+        EXPECT_EQ(reset[0].second.m_id, id);
+        EXPECT_FALSE(table.IsVerified(m_debugName, 5));
+        EXPECT_TRUE(table.ResetVerified().empty());
+    }
+} // namespace LUADebugger
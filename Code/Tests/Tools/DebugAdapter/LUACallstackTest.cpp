@@ -0,0 +1,83 @@
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <Tools/DebugAdapter/LUACallstack.h>
+
+namespace LUADebugger
+{
+    class LUACallstackTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    TEST_F(LUACallstackTest, SetCallstack_LuaFrames_ParsesModuleLineAndFunction)
+    {
+        LUACallstack callstack;
+        callstack.Reset();
+        EXPECT_FALSE(callstack.HasFrames());
+
+        callstack.SetCallstack("[Lua] @scripts/foo.lua (12) : OnActivate(method)\n@scripts/bar.lua (3)\n");
+
+        ASSERT_TRUE(callstack.HasFrames());
+        const auto& frames = callstack.GetFrames();
+        ASSERT_EQ(frames.size(), 2);
+        EXPECT_EQ(frames[0].m_module, "@scripts/foo.lua");
+        EXPECT_EQ(frames[0].m_line, 12);
+        EXPECT_EQ(frames[0].m_function, "OnActivate");
+        EXPECT_EQ(frames[1].m_module, "@scripts/bar.lua");
+        EXPECT_EQ(frames[1].m_line, 3);
+        EXPECT_EQ(frames[1].m_function, "?");
+    }
+
+    TEST_F(LUACallstackTest, SetCallstack_OtherFrame_KeptWholeAsFunction)
+    {
+        LUACallstack callstack;
+        callstack.SetCallstack("[C] print");
+
+        ASSERT_EQ(callstack.GetFrames().size(), 1);
+        EXPECT_TRUE(callstack.GetFrames()[0].m_module.empty());
+        EXPECT_EQ(callstack.GetFrames()[0].m_function, "print");
+    }
+
+    TEST_F(LUACallstackTest, SetCallstack_CarriageReturnsAndEmptyLines_Skipped)
+    {
+        LUACallstack callstack;
+        callstack.SetCallstack("\r\n@scripts/foo.lua (1) : Update(global)\r\n\n@scripts/foo.lua (2) : Tick\r\n");
+
+        ASSERT_EQ(callstack.GetFrames().size(), 2);
+        EXPECT_EQ(callstack.GetFrames()[0].m_function, "Update");
+        EXPECT_EQ(callstack.GetFrames()[1].m_function, "Tick");
+        EXPECT_EQ(callstack.GetFrames()[1].m_line, 2);
+    }
+
+    TEST_F(LUACallstackTest, GetFrameIndex_FrameIds_MapToFrames)
+    {
+        LUACallstack callstack;
+        callstack.Reset();
+        callstack.SetCallstack("@a.lua (1)\n@b.lua (2)\n@c.lua (3)");
+
+        const auto& frames = callstack.GetFrames();
+        ASSERT_EQ(frames.size(), 3);
+        for (size_t i = 0; i < frames.size(); ++i)
+        {
+            EXPECT_EQ(callstack.GetFrameIndex(frames[i].m_id), static_cast<int>(i));
+        }
+        EXPECT_EQ(callstack.GetFrameIndex(frames.back().m_id + 1), -1);
+        EXPECT_EQ(callstack.GetFrameIndex(0), -1);
+    }
+
+    TEST_F(LUACallstackTest, GetFrameIndex_IdOfOlderStop_Rejected)
+    {
+        LUACallstack callstack;
+        callstack.Reset();
+        callstack.SetCallstack("@a.lua (1)");
+        const AZ::s64 oldId = callstack.GetFrames()[0].m_id;
+
+        callstack.Reset();
+        EXPECT_FALSE(callstack.HasFrames());
+        callstack.SetCallstack("@a.lua (1)");
+
+        EXPECT_NE(callstack.GetFrames()[0].m_id, oldId);
+        EXPECT_EQ(callstack.GetFrameIndex(oldId), -1);
+        EXPECT_EQ(callstack.GetFrameIndex(callstack.GetFrames()[0].m_id), 0);
+    }
+} // namespace LUADebugger
@@ -0,0 +1,221 @@
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Script/ScriptDebugMsgReflection.h>
+#include <AzTest/AzTest.h>
+#include <Tools/DebugAdapter/LUARemoteRequests.h>
+
+namespace LUADebugger
+{
+    class LUARemoteRequestsTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        static constexpr AZ::Crc32 GetValue = AZ_CRC_CE("GetValue");
+        static constexpr AZ::Crc32 GetCallstack = AZ_CRC_CE("GetCallstack");
+        static constexpr AZStd::chrono::milliseconds Timeout{ 100 };
+
+        // records what each continuation was run with, in the order they ran
+        LUARemoteRequests::Continuation Record(int id)
+        {
+            return [this, id](AzFramework::RemoteToolsMessage* reply)
+            {
+                m_calls.emplace_back(id, reply);
+            };
+        }
+
+        AZStd::vector<AZStd::pair<int, AzFramework::RemoteToolsMessage*>> m_calls;
+        AzFramework::ScriptDebugAck m_reply{ GetValue, AZ_CRC_CE("Ack") };
+        AzFramework::ScriptDebugAck m_otherReply{ GetValue, AZ_CRC_CE("Ack") };
+    };
+
+    TEST_F(LUARemoteRequestsTest, Track_IdenticalRequest_JoinsAndResolvesInOrder)
+    {
+        LUARemoteRequests requests;
+        EXPECT_TRUE(requests.Track(GetValue, "x", Timeout, Record(1)));
+        EXPECT_FALSE(requests.Track(GetValue, "x", Timeout, Record(2)));
+        // another argument is another request
+        EXPECT_TRUE(requests.Track(GetValue, "y", Timeout, Record(3)));
+
+        EXPECT_TRUE(requests.Resolve(GetValue, "x", &m_reply));
+        ASSERT_EQ(m_calls.size(), 2);
+        EXPECT_EQ(m_calls[0], AZStd::make_pair(1, static_cast<AzFramework::RemoteToolsMessage*>(&m_reply)));
+        EXPECT_EQ(m_calls[1], AZStd::make_pair(2, static_cast<AzFramework::RemoteToolsMessage*>(&m_reply)));
+
+        // nothing of "x" is in flight anymore
+        EXPECT_FALSE(requests.Resolve(GetValue, "x", &m_reply));
+        EXPECT_FALSE(requests.IsEmpty());
+        EXPECT_TRUE(requests.Resolve(GetValue, "y", &m_reply));
+        EXPECT_EQ(m_calls.size(), 3);
+        EXPECT_TRUE(requests.IsEmpty());
+    }
+
+    TEST_F(LUARemoteRequestsTest, Resolve_ContinuationTracksSameRequest_SentAgain)
+    {
+        LUARemoteRequests requests;
+        bool sentAgain = false;
+        requests.Track(GetValue, "x", Timeout, [&](AzFramework::RemoteToolsMessage*)
+            {
+                sentAgain = requests.Track(GetValue, "x", Timeout, Record(2));
+            });
+
+        EXPECT_TRUE(requests.Resolve(GetValue, "x", &m_reply));
+        EXPECT_TRUE(sentAgain);
+        EXPECT_TRUE(requests.Resolve(GetValue, "x", &m_otherReply));
+        ASSERT_EQ(m_calls.size(), 1);
+        EXPECT_EQ(m_calls[0].second, &m_otherReply);
+    }
+
+    TEST_F(LUARemoteRequestsTest, Update_Timeout_RunsWithNullAndDropsLateReply)
+    {
+        LUARemoteRequests requests;
+        requests.Track(GetValue, "x", Timeout, Record(1));
+
+        requests.Update(LUARemoteRequests::Clock::now());
+        EXPECT_TRUE(m_calls.empty());
+
+        requests.Update(LUARemoteRequests::Clock::now() + Timeout * 2);
+        ASSERT_EQ(m_calls.size(), 1);
+        EXPECT_EQ(m_calls[0].second, nullptr);
+
+        // a timed out request is not joined, the same request is sent again
+        EXPECT_TRUE(requests.Track(GetValue, "x", Timeout, Record(2)));
+
+        // the late reply belongs to the timed out request, the new one gets the next
+        EXPECT_TRUE(requests.Resolve(GetValue, "x", &m_reply));
+        EXPECT_EQ(m_calls.size(), 1);
+        EXPECT_TRUE(requests.Resolve(GetValue, "x", &m_otherReply));
+        ASSERT_EQ(m_calls.size(), 2);
+        EXPECT_EQ(m_calls[1], AZStd::make_pair(2, static_cast<AzFramework::RemoteToolsMessage*>(&m_otherReply)));
+        EXPECT_TRUE(requests.IsEmpty());
+    }
+
+    TEST_F(LUARemoteRequestsTest, Update_TombstoneExpired_Dropped)
+    {
+        LUARemoteRequests requests;
+        requests.Track(GetValue, "x", Timeout, Record(1));
+
+        requests.Update(LUARemoteRequests::Clock::now() + Timeout * 2);
+        EXPECT_FALSE(requests.IsEmpty());
+
+        requests.Update(LUARemoteRequests::Clock::now() + Timeout * 2 + LUARemoteRequests::TombstoneLifetime);
+        EXPECT_TRUE(requests.IsEmpty());
+        EXPECT_EQ(m_calls.size(), 1);
+        EXPECT_FALSE(requests.Resolve(GetValue, "x", &m_reply));
+    }
+
+    TEST_F(LUARemoteRequestsTest, Cancel_OnlyThatRequest_RunsWithNullAndDropsLateReply)
+    {
+        LUARemoteRequests requests;
+        requests.Track(GetValue, "x", Timeout, Record(1));
+        requests.Track(GetValue, "y", Timeout, Record(2));
+        requests.Track(GetCallstack, "", Timeout, Record(3));
+
+        requests.Cancel(GetValue);
+        ASSERT_EQ(m_calls.size(), 2);
+        EXPECT_EQ(m_calls[0].second, nullptr);
+        EXPECT_EQ(m_calls[1].second, nullptr);
+
+        EXPECT_TRUE(requests.Track(GetValue, "x", Timeout, Record(4)));
+        EXPECT_TRUE(requests.Resolve(GetValue, "x", &m_reply));
+        EXPECT_EQ(m_calls.size(), 2);
+        EXPECT_TRUE(requests.Resolve(GetValue, "x", &m_otherReply));
+        ASSERT_EQ(m_calls.size(), 3);
+        EXPECT_EQ(m_calls[2], AZStd::make_pair(4, static_cast<AzFramework::RemoteToolsMessage*>(&m_otherReply)));
+
+        EXPECT_TRUE(requests.Resolve(GetCallstack, "", &m_reply));
+        ASSERT_EQ(m_calls.size(), 4);
+        EXPECT_EQ(m_calls[3].first, 3);
+    }
+
+    TEST_F(LUARemoteRequestsTest, CancelAll_EveryRequest_RunsWithNull)
+    {
+        LUARemoteRequests requests;
+        requests.Track(GetValue, "x", Timeout, Record(1));
+        requests.Track(GetValue, "x", Timeout, Record(2));
+        requests.Track(GetCallstack, "", Timeout, Record(3));
+
+        requests.CancelAll();
+        ASSERT_EQ(m_calls.size(), 3);
+        for (const auto& call : m_calls)
+        {
+            EXPECT_EQ(call.second, nullptr);
+        }
+
+        // cancelled requests are not timed out a second time
+        requests.Update(LUARemoteRequests::Clock::now() + Timeout * 2);
+        EXPECT_EQ(m_calls.size(), 3);
+    }
+
+    TEST_F(LUARemoteRequestsTest, ResolveOldest_RefusedRequest_NextIdenticalRequestGetsItsReply)
+    {
+        LUARemoteRequests requests;
+        requests.Track(GetCallstack, "", Timeout, Record(1));
+
+        // refused, nothing else will be replied to it
+        EXPECT_TRUE(requests.ResolveOldest(GetCallstack, nullptr));
+        ASSERT_EQ(m_calls.size(), 1);
+        EXPECT_EQ(m_calls[0].second, nullptr);
+        EXPECT_TRUE(requests.IsEmpty());
+
+        EXPECT_TRUE(requests.Track(GetCallstack, "", Timeout, Record(2)));
+        EXPECT_TRUE(requests.Resolve(GetCallstack, "", &m_reply));
+        ASSERT_EQ(m_calls.size(), 2);
+        EXPECT_EQ(m_calls[1], AZStd::make_pair(2, static_cast<AzFramework::RemoteToolsMessage*>(&m_reply)));
+    }
+
+    TEST_F(LUARemoteRequestsTest, ResolveOldest_OtherArguments_ResolvedInSendOrder)
+    {
+        LUARemoteRequests requests;
+        requests.Track(GetValue, "x", Timeout, Record(1));
+        requests.Track(GetValue, "y", Timeout, Record(2));
+        // joined, not sent a second time
+        requests.Track(GetValue, "x", Timeout, Record(3));
+
+        EXPECT_TRUE(requests.ResolveOldest(GetValue, nullptr));
+        ASSERT_EQ(m_calls.size(), 2);
+        EXPECT_EQ(m_calls[0], AZStd::make_pair(1, static_cast<AzFramework::RemoteToolsMessage*>(nullptr)));
+        EXPECT_EQ(m_calls[1], AZStd::make_pair(3, static_cast<AzFramework::RemoteToolsMessage*>(nullptr)));
+
+        EXPECT_TRUE(requests.Track(GetValue, "x", Timeout, Record(4)));
+        EXPECT_TRUE(requests.Resolve(GetValue, "y", &m_reply));
+        EXPECT_TRUE(requests.ResolveOldest(GetValue, nullptr));
+        ASSERT_EQ(m_calls.size(), 4);
+        EXPECT_EQ(m_calls[2].first, 2);
+        EXPECT_EQ(m_calls[3], AZStd::make_pair(4, static_cast<AzFramework::RemoteToolsMessage*>(nullptr)));
+        EXPECT_FALSE(requests.ResolveOldest(GetValue, nullptr));
+        EXPECT_TRUE(requests.IsEmpty());
+    }
+
+    TEST_F(LUARemoteRequestsTest, ResolveOldest_TimedOutRequest_ConsumesTombstone)
+    {
+        LUARemoteRequests requests;
+        requests.Track(GetCallstack, "", Timeout, Record(1));
+        requests.Update(LUARemoteRequests::Clock::now() + Timeout * 2);
+        EXPECT_TRUE(requests.Track(GetCallstack, "", Timeout, Record(2)));
+
+        // the refusal belongs to the timed out request, the new one gets the next reply
+        EXPECT_TRUE(requests.ResolveOldest(GetCallstack, nullptr));
+        EXPECT_EQ(m_calls.size(), 1);
+        EXPECT_TRUE(requests.Resolve(GetCallstack, "", &m_reply));
+        ASSERT_EQ(m_calls.size(), 2);
+        EXPECT_EQ(m_calls[1], AZStd::make_pair(2, static_cast<AzFramework::RemoteToolsMessage*>(&m_reply)));
+    }
+
+    TEST_F(LUARemoteRequestsTest, Clear_EveryRequest_RunsWithNullAndLeavesNoTombstone)
+    {
+        LUARemoteRequests requests;
+        requests.Track(GetValue, "x", Timeout, Record(1));
+        requests.Track(GetCallstack, "", Timeout, Record(2));
+
+        requests.Clear();
+        ASSERT_EQ(m_calls.size(), 2);
+        EXPECT_EQ(m_calls[0].second, nullptr);
+        EXPECT_EQ(m_calls[1].second, nullptr);
+        EXPECT_TRUE(requests.IsEmpty());
+
+        // the same request after a reattach gets the first reply
+        EXPECT_TRUE(requests.Track(GetCallstack, "", Timeout, Record(3)));
+        EXPECT_TRUE(requests.Resolve(GetCallstack, "", &m_reply));
+        ASSERT_EQ(m_calls.size(), 3);
+        EXPECT_EQ(m_calls[2], AZStd::make_pair(3, static_cast<AzFramework::RemoteToolsMessage*>(&m_reply)));
+    }
+} // namespace LUADebugger
@@ -0,0 +1,179 @@
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <Tools/DebugAdapter/LUAVariables.h>
+
+namespace LUADebugger
+{
+    class LUAVariableStoreTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        // LUA_TNUMBER and LUA_TTABLE
+        static constexpr char NumberType = 3;
+        static constexpr char TableType = 5;
+
+        static AZ::ScriptContextDebug::DebugValue MakeNumber(const AZStd::string& name, int value)
+        {
+            AZ::ScriptContextDebug::DebugValue number;
+            number.m_name = name;
+            number.m_value = AZStd::string::format("%d", value);
+            number.m_type = NumberType;
+            return number;
+        }
+
+        static AZ::ScriptContextDebug::DebugValue MakeTable(const AZStd::string& name, size_t size)
+        {
+            AZ::ScriptContextDebug::DebugValue table;
+            table.m_name = name;
+            table.m_type = TableType;
+            for (size_t i = 0; i < size; ++i)
+            {
+                table.m_elements.push_back(MakeNumber(AZStd::string::format("[%zu]", i + 1), static_cast<int>(i)));
+            }
+            return table;
+        }
+
+        // a store for a new stop with the locals "count" and "items", items holding size entries
+        static void SetStop(LUAVariableStore& store, size_t size)
+        {
+            store.Reset();
+            store.SetLocals({ "count", "items" });
+            store.SetValue(MakeNumber("count", 3));
+            store.SetValue(MakeTable("items", size));
+        }
+    };
+
+    TEST_F(LUAVariableStoreTest, SetValue_ValuesArrive_CompletesLocals)
+    {
+        LUAVariableStore store;
+        store.Reset();
+        EXPECT_FALSE(store.HasLocals());
+        EXPECT_FALSE(store.IsReady(store.GetLocalsReference()));
+
+        store.SetLocals({ "a", "b" });
+        EXPECT_TRUE(store.HasLocals());
+        EXPECT_EQ(store.GetMissingValues(), AZStd::vector<AZStd::string>({ "a", "b" }));
+
+        store.SetValue(MakeNumber("b", 2));
+        // not a local of this stop
+        store.SetValue(MakeNumber("c", 3));
+        EXPECT_TRUE(store.HasValue("b"));
+        EXPECT_FALSE(store.HasValue("c"));
+        EXPECT_FALSE(store.IsComplete());
+        EXPECT_EQ(store.GetMissingValues(), AZStd::vector<AZStd::string>({ "a" }));
+
+        store.SetValue(MakeNumber("a", 1));
+        EXPECT_TRUE(store.IsComplete());
+        EXPECT_TRUE(store.IsReady(store.GetLocalsReference()));
+        EXPECT_TRUE(store.GetMissingValues().empty());
+    }
+
+    TEST_F(LUAVariableStoreTest, GetVariables_Locals_RowsInOrder)
+    {
+        LUAVariableStore store;
+        SetStop(store, 3);
+
+        AZStd::vector<LUAVariable> variables;
+        ASSERT_TRUE(store.GetVariables(store.GetLocalsReference(), "", 0, 0, variables));
+        ASSERT_EQ(variables.size(), 2);
+        EXPECT_EQ(variables[0].m_name, "count");
+        EXPECT_EQ(variables[0].m_value, "3");
+        EXPECT_EQ(variables[0].m_type, "number");
+        EXPECT_EQ(variables[0].m_reference, 0);
+        EXPECT_EQ(variables[1].m_name, "items");
+        EXPECT_EQ(variables[1].m_value, "table[3]");
+        EXPECT_EQ(variables[1].m_type, "table");
+        EXPECT_NE(variables[1].m_reference, 0);
+    }
+
+    TEST_F(LUAVariableStoreTest, GetVariables_SmallTable_NamedChildren)
+    {
+        LUAVariableStore store;
+        SetStop(store, 3);
+
+        AZStd::vector<LUAVariable> locals;
+        store.GetVariables(store.GetLocalsReference(), "", 0, 0, locals);
+        ASSERT_EQ(locals.size(), 2);
+        EXPECT_EQ(locals[1].m_namedChildren, 3);
+        EXPECT_EQ(locals[1].m_indexedChildren, 0);
+
+        AZStd::vector<LUAVariable> children;
+        ASSERT_TRUE(store.GetVariables(locals[1].m_reference, "indexed", 0, 0, children));
+        EXPECT_TRUE(children.empty());
+        ASSERT_TRUE(store.GetVariables(locals[1].m_reference, "named", 0, 0, children));
+        ASSERT_EQ(children.size(), 3);
+        EXPECT_EQ(children[2].m_name, "[3]");
+    }
+
+    TEST_F(LUAVariableStoreTest, GetVariables_LargeTable_PagedIndexedChildren)
+    {
+        const size_t size = LUAVariableStore::PageSize * 2 + 50;
+        LUAVariableStore store;
+        SetStop(store, size);
+
+        AZStd::vector<LUAVariable> locals;
+        store.GetVariables(store.GetLocalsReference(), "", 0, 0, locals);
+        ASSERT_EQ(locals.size(), 2);
+        EXPECT_EQ(locals[1].m_namedChildren, 0);
+        EXPECT_EQ(locals[1].m_indexedChildren, size);
+
+        AZStd::vector<LUAVariable> page;
+        ASSERT_TRUE(store.GetVariables(locals[1].m_reference, "named", 0, 0, page));
+        EXPECT_TRUE(page.empty());
+
+        ASSERT_TRUE(store.GetVariables(locals[1].m_reference, "indexed", LUAVariableStore::PageSize, LUAVariableStore::PageSize, page));
+        ASSERT_EQ(page.size(), LUAVariableStore::PageSize);
+        EXPECT_EQ(page.front().m_name, AZStd::string::format("[%zu]", LUAVariableStore::PageSize + 1));
+        EXPECT_EQ(page.back().m_name, AZStd::string::format("[%zu]", LUAVariableStore::PageSize * 2));
+
+        // the last page is cut at the end of the table
+        page.clear();
+        ASSERT_TRUE(store.GetVariables(locals[1].m_reference, "indexed", LUAVariableStore::PageSize * 2, LUAVariableStore::PageSize, page));
+        EXPECT_EQ(page.size(), 50);
+    }
+
+    TEST_F(LUAVariableStoreTest, GetVariables_SameTableTwice_SameReference)
+    {
+        LUAVariableStore store;
+        SetStop(store, 3);
+
+        AZStd::vector<LUAVariable> first;
+        AZStd::vector<LUAVariable> second;
+        store.GetVariables(store.GetLocalsReference(), "", 0, 0, first);
+        store.GetVariables(store.GetLocalsReference(), "", 0, 0, second);
+        ASSERT_EQ(first.size(), 2);
+        ASSERT_EQ(second.size(), 2);
+        EXPECT_EQ(first[1].m_reference, second[1].m_reference);
+    }
+
+    TEST_F(LUAVariableStoreTest, GetVariables_ReferenceOfOlderStop_Rejected)
+    {
+        LUAVariableStore store;
+        SetStop(store, 3);
+        const AZ::s64 oldLocals = store.GetLocalsReference();
+        AZStd::vector<LUAVariable> locals;
+        store.GetVariables(oldLocals, "", 0, 0, locals);
+        ASSERT_EQ(locals.size(), 2);
+        const AZ::s64 oldTable = locals[1].m_reference;
+
+        SetStop(store, 3);
+
+        AZStd::vector<LUAVariable> variables;
+        EXPECT_NE(store.GetLocalsReference(), oldLocals);
+        EXPECT_FALSE(store.GetVariables(oldLocals, "", 0, 0, variables));
+        EXPECT_FALSE(store.GetVariables(oldTable, "", 0, 0, variables));
+        EXPECT_TRUE(variables.empty());
+        EXPECT_TRUE(store.GetVariables(store.GetLocalsReference(), "", 0, 0, variables));
+    }
+
+    TEST_F(LUAVariableStoreTest, GetVariables_UnknownReference_Rejected)
+    {
+        LUAVariableStore store;
+        SetStop(store, 3);
+
+        AZStd::vector<LUAVariable> variables;
+        EXPECT_FALSE(store.GetVariables(0, "", 0, 0, variables));
+        // no table was handed out yet
+        EXPECT_FALSE(store.GetVariables(store.GetLocalsReference() + 1, "", 0, 0, variables));
+    }
+} // namespace LUADebugger
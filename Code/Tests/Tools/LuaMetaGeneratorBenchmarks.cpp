@@ -0,0 +1,337 @@
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/Utils.h>
+#include <AzToolsFramework/Script/LuaSymbolsReporterBus.h>
+#include <LuaVSCode/LuaVSCodeBus.h>
+#include <Tools/LuaMetaGenerator.h>
+#include <benchmark/benchmark.h>
+
+namespace LuaVSCode
+{
+    // Runs LuaMetaGenerator::CaptureSymbols() on a synthetic BehaviorContext and Generate() on synthetic snapshots shaped like one.
+    // Arguments are classes, methods per class and arguments per method, EBuses get the same number of events as classes have methods.
+    // Counters: "files" and "bytes" written per generation, "retainedBytes" is how much of what the measured call allocated
+    // the generator still holds afterwards. The SystemAllocator keeps no allocation count, so this is not one.
+    class LuaMetaGeneratorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        // spread over a few prefixes so sharded output has more than one shard
+        static constexpr const char* NamePrefixes[] = { "Editor", "Physics", "Render", "Script", "Asset", "UI", "Network", "Audio" };
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZ::JobManagerDesc jobManagerDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (unsigned int i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        static LuaMetaSymbols CreateSymbols(size_t classCount, size_t methodCount, size_t argumentCount)
+        {
+            LuaMetaSymbols symbols;
+            const AZStd::string_view argumentTypes[] = {
+                symbols.m_typeNames.Intern("Number"),
+                symbols.m_typeNames.Intern("String"),
+                symbols.m_typeNames.Intern("Vector3"),
+                symbols.m_typeNames.Intern("EntityId")
+            };
+
+            auto createMethod = [&symbols, &argumentTypes, argumentCount](size_t methodIndex, LuaMetaMethodKind kind)
+            {
+                LuaMetaMethod method;
+                method.m_name = AZStd::string::format("Method%zu", methodIndex);
+                method.m_kind = kind;
+                method.m_hasSignature = true;
+                method.m_parameters.reserve(argumentCount);
+                for (size_t argumentIndex = 0; argumentIndex < argumentCount; ++argumentIndex)
+                {
+                    method.m_parameters.push_back({ argumentTypes[argumentIndex % AZ_ARRAY_SIZE(argumentTypes)],
+                        symbols.m_tooltips.Intern(AZStd::string::format("Tooltip for argument %zu", argumentIndex)) });
+                }
+                method.m_result = argumentTypes[methodIndex % AZ_ARRAY_SIZE(argumentTypes)];
+                return method;
+            };
+
+            symbols.m_classes.reserve(classCount);
+            symbols.m_ebuses.reserve(classCount);
+            for (size_t classIndex = 0; classIndex < classCount; ++classIndex)
+            {
+                const char* prefix = NamePrefixes[classIndex % AZ_ARRAY_SIZE(NamePrefixes)];
+
+                LuaMetaClass& luaClass = symbols.m_classes.emplace_back();
+                luaClass.m_name = AZStd::string::format("%sClass%zu", prefix, classIndex);
+                luaClass.m_properties = { "x", "y", "z" };
+                luaClass.m_methods.reserve(methodCount);
+                for (size_t methodIndex = 0; methodIndex < methodCount; ++methodIndex)
+                {
+                    luaClass.m_methods.push_back(createMethod(methodIndex, LuaMetaMethodKind::Function));
+                }
+
+                LuaMetaEBus& ebus = symbols.m_ebuses.emplace_back();
+                ebus.m_name = AZStd::string::format("%sNotification%zuBus", prefix, classIndex);
+                ebus.m_hasSenders = methodCount > 0;
+                ebus.m_canBroadcast = true;
+                ebus.m_senders.reserve(methodCount * 2);
+                for (size_t methodIndex = 0; methodIndex < methodCount; ++methodIndex)
+                {
+                    ebus.m_senders.push_back(createMethod(methodIndex, LuaMetaMethodKind::Event));
+                    ebus.m_senders.push_back(createMethod(methodIndex, LuaMetaMethodKind::Broadcast));
+                }
+            }
+
+            for (size_t globalIndex = 0; globalIndex < classCount; ++globalIndex)
+            {
+                symbols.m_globalProperties.push_back(AZStd::string::format("g_Property%zu", globalIndex));
+
+                LuaMetaMethod& globalFunction = symbols.m_globalFunctions.emplace_back();
+                globalFunction.m_name = AZStd::string::format("GlobalFunction%zu", globalIndex);
+                globalFunction.m_debugArgumentInfo = "number, string";
+            }
+            return symbols;
+        }
+
+        static float SyntheticMethod([[maybe_unused]] int index, [[maybe_unused]] float value, [[maybe_unused]] const AZStd::string& name)
+        {
+            return 0.0f;
+        }
+        using SyntheticMethodImpl = AZ::Internal::BehaviorMethodImpl<float(int, float, const AZStd::string&)>;
+
+        // lists what ReflectSynthetic() reflected, like the reporter does for a real BehaviorContext
+        class SyntheticSymbolsReporter
+            : public AzToolsFramework::Script::LuaSymbolsReporterRequests
+        {
+        public:
+            const AZStd::vector<AzToolsFramework::Script::LuaClassSymbol>& GetListOfClasses() override { return m_classes; }
+            const AZStd::vector<AzToolsFramework::Script::LuaPropertySymbol>& GetListOfGlobalProperties() override { return m_globalProperties; }
+            const AZStd::vector<AzToolsFramework::Script::LuaMethodSymbol>& GetListOfGlobalFunctions() override { return m_globalFunctions; }
+            const AZStd::vector<AzToolsFramework::Script::LuaEBusSymbol>& GetListOfEBuses() override { return m_ebuses; }
+
+            AZStd::vector<AzToolsFramework::Script::LuaClassSymbol> m_classes;
+            AZStd::vector<AzToolsFramework::Script::LuaPropertySymbol> m_globalProperties;
+            AZStd::vector<AzToolsFramework::Script::LuaMethodSymbol> m_globalFunctions;
+            AZStd::vector<AzToolsFramework::Script::LuaEBusSymbol> m_ebuses;
+        };
+
+        // Thousands of distinct C++ types cannot be reflected at runtime, so the classes and EBuses are added to the
+        // BehaviorContext maps the way the builders do. The context owns and deletes them like reflected ones.
+        static void ReflectSynthetic(AZ::BehaviorContext& behaviorContext, SyntheticSymbolsReporter& reporter, size_t classCount, size_t methodCount)
+        {
+            reporter.m_classes.reserve(classCount);
+            reporter.m_ebuses.reserve(classCount);
+            for (size_t classIndex = 0; classIndex < classCount; ++classIndex)
+            {
+                const char* prefix = NamePrefixes[classIndex % AZ_ARRAY_SIZE(NamePrefixes)];
+
+                AZ::BehaviorClass* behaviorClass = aznew AZ::BehaviorClass();
+                behaviorClass->m_name = AZStd::string::format("%sClass%zu", prefix, classIndex);
+                behaviorClass->m_typeId = AZ::Uuid::CreateName(behaviorClass->m_name.c_str());
+                AzToolsFramework::Script::LuaClassSymbol& luaClass = reporter.m_classes.emplace_back();
+                luaClass.m_name = behaviorClass->m_name;
+                luaClass.m_typeId = behaviorClass->m_typeId;
+                for (size_t methodIndex = 0; methodIndex < methodCount; ++methodIndex)
+                {
+                    AZStd::string methodName = AZStd::string::format("Method%zu", methodIndex);
+                    behaviorClass->m_methods.emplace(methodName, aznew SyntheticMethodImpl(&SyntheticMethod, &behaviorContext, methodName));
+                    luaClass.m_methods.emplace_back().m_name = AZStd::move(methodName);
+                }
+                behaviorContext.m_classes.emplace(behaviorClass->m_name, behaviorClass);
+                behaviorContext.m_typeToClassMap.emplace(behaviorClass->m_typeId, behaviorClass);
+
+                AZ::BehaviorEBus* behaviorEBus = aznew AZ::BehaviorEBus();
+                behaviorEBus->m_name = AZStd::string::format("%sNotification%zuBus", prefix, classIndex);
+                AzToolsFramework::Script::LuaEBusSymbol& luaEBus = reporter.m_ebuses.emplace_back();
+                luaEBus.m_name = behaviorEBus->m_name;
+                luaEBus.m_canBroadcast = methodCount > 0;
+                for (size_t methodIndex = 0; methodIndex < methodCount; ++methodIndex)
+                {
+                    AZStd::string eventName = AZStd::string::format("Event%zu", methodIndex);
+                    AZ::BehaviorEBusEventSender& sender = behaviorEBus->m_events[eventName];
+                    sender.m_event = aznew SyntheticMethodImpl(&SyntheticMethod, &behaviorContext, eventName);
+                    sender.m_broadcast = aznew SyntheticMethodImpl(&SyntheticMethod, &behaviorContext, eventName);
+                    luaEBus.m_senders.emplace_back().m_name = AZStd::move(eventName);
+                }
+                behaviorContext.m_ebuses.emplace(behaviorEBus->m_name, behaviorEBus);
+            }
+        }
+
+        static size_t GetAllocatedBytes()
+        {
+            return AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        }
+
+        // one generator per iteration, like a launch of the Editor, only Generate() is timed
+        void RunGenerate(benchmark::State& state, const LuaMetaGeneratorSettings& settings, bool reuseOutput)
+        {
+            const size_t classCount = static_cast<size_t>(state.range(0));
+            const size_t methodCount = static_cast<size_t>(state.range(1));
+            const size_t argumentCount = static_cast<size_t>(state.range(2));
+
+            if (reuseOutput)
+            {
+                LuaMetaGenerator generator;
+                generator.SetSymbols(CreateSymbols(classCount, methodCount, argumentCount));
+                generator.SetSettings(settings);
+                generator.SetOutputPath(m_tempDirectory.Resolve("meta"));
+                generator.Generate();
+                LuaVSCodeNotificationBus::ClearQueuedEvents();
+            }
+
+            size_t filesWritten = 0;
+            size_t bytesWritten = 0;
+            size_t retainedBytes = 0;
+            size_t iteration = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                auto generator = AZStd::make_unique<LuaMetaGenerator>();
+                generator->SetSymbols(CreateSymbols(classCount, methodCount, argumentCount));
+                generator->SetSettings(settings);
+                // a fresh folder makes every file stale, reusing one measures a launch without reflection changes
+                generator->SetOutputPath(
+                    m_tempDirectory.Resolve(reuseOutput ? "meta" : AZStd::string::format("meta%zu", iteration++).c_str()));
+                // sampled once the snapshot is in so only what Generate() keeps is counted
+                const size_t allocatedBefore = GetAllocatedBytes();
+                state.ResumeTiming();
+
+                generator->Generate();
+
+                state.PauseTiming();
+                // nothing ticks the notification queue here, it would otherwise grow with every iteration
+                LuaVSCodeNotificationBus::ClearQueuedEvents();
+                for (const LuaMetaOutput& output : generator->GetOutputs())
+                {
+                    if (output.m_stale)
+                    {
+                        ++filesWritten;
+                        bytesWritten += output.m_writer.GetSize();
+                    }
+                }
+                retainedBytes += GetAllocatedBytes() - allocatedBefore;
+                generator.reset();
+                state.ResumeTiming();
+            }
+
+            state.counters["files"] = benchmark::Counter(static_cast<double>(filesWritten), benchmark::Counter::kAvgIterations);
+            state.counters["bytes"] = benchmark::Counter(static_cast<double>(bytesWritten), benchmark::Counter::kAvgIterations);
+            state.counters["retainedBytes"] = benchmark::Counter(static_cast<double>(retainedBytes), benchmark::Counter::kAvgIterations);
+            state.SetBytesProcessed(static_cast<int64_t>(bytesWritten));
+        }
+
+        // one generator per iteration, only CaptureSymbols() is timed
+        void RunCapture(benchmark::State& state, const LuaMetaGeneratorSettings& settings)
+        {
+            const size_t classCount = static_cast<size_t>(state.range(0));
+            const size_t methodCount = static_cast<size_t>(state.range(1));
+
+            AZ::BehaviorContext behaviorContext;
+            SyntheticSymbolsReporter reporter;
+            ReflectSynthetic(behaviorContext, reporter, classCount, methodCount);
+
+            size_t methodsCaptured = 0;
+            size_t retainedBytes = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                auto generator = AZStd::make_unique<LuaMetaGenerator>();
+                generator->SetSettings(settings);
+                const size_t allocatedBefore = GetAllocatedBytes();
+                state.ResumeTiming();
+
+                generator->CaptureSymbols(behaviorContext, reporter, {});
+
+                state.PauseTiming();
+                for (const LuaMetaClass& luaClass : generator->GetSymbols().m_classes)
+                {
+                    methodsCaptured += luaClass.m_methods.size();
+                }
+                for (const LuaMetaEBus& ebus : generator->GetSymbols().m_ebuses)
+                {
+                    methodsCaptured += ebus.m_senders.size();
+                }
+                retainedBytes += GetAllocatedBytes() - allocatedBefore;
+                generator.reset();
+                state.ResumeTiming();
+            }
+
+            state.counters["methods"] = benchmark::Counter(static_cast<double>(methodsCaptured), benchmark::Counter::kAvgIterations);
+            state.counters["retainedBytes"] = benchmark::Counter(static_cast<double>(retainedBytes), benchmark::Counter::kAvgIterations);
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    BENCHMARK_DEFINE_F(LuaMetaGeneratorBenchmarkFixture, Capture)(benchmark::State& state)
+    {
+        RunCapture(state, {});
+    }
+
+    BENCHMARK_DEFINE_F(LuaMetaGeneratorBenchmarkFixture, CaptureLean)(benchmark::State& state)
+    {
+        LuaMetaGeneratorSettings settings;
+        settings.m_profile = LuaMetaProfile::Lean;
+        RunCapture(state, settings);
+    }
+
+    BENCHMARK_DEFINE_F(LuaMetaGeneratorBenchmarkFixture, Generate)(benchmark::State& state)
+    {
+        RunGenerate(state, {}, false);
+    }
+
+    BENCHMARK_DEFINE_F(LuaMetaGeneratorBenchmarkFixture, GenerateSharded)(benchmark::State& state)
+    {
+        LuaMetaGeneratorSettings settings;
+        settings.m_sharded = true;
+        RunGenerate(state, settings, false);
+    }
+
+    BENCHMARK_DEFINE_F(LuaMetaGeneratorBenchmarkFixture, GenerateUnchanged)(benchmark::State& state)
+    {
+        RunGenerate(state, {}, true);
+    }
+
+    // classes x methods x arguments, the last is close to a project with all the default gems enabled
+    static void GenerateArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->Args({ 100, 8, 2 })->Args({ 1000, 8, 2 })->Args({ 1000, 32, 4 })->Args({ 3000, 16, 3 });
+    }
+
+    // classes x methods, the synthetic methods all take three arguments
+    static void CaptureArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->Args({ 100, 8 })->Args({ 1000, 8 })->Args({ 1000, 32 })->Args({ 3000, 16 });
+    }
+
+    BENCHMARK_REGISTER_F(LuaMetaGeneratorBenchmarkFixture, Capture)->Apply(CaptureArguments)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(LuaMetaGeneratorBenchmarkFixture, CaptureLean)->Apply(CaptureArguments)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(LuaMetaGeneratorBenchmarkFixture, Generate)->Apply(GenerateArguments)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(LuaMetaGeneratorBenchmarkFixture, GenerateSharded)->Apply(GenerateArguments)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(LuaMetaGeneratorBenchmarkFixture, GenerateUnchanged)->Apply(GenerateArguments)->Unit(benchmark::kMillisecond);
+} // namespace LuaVSCode
+
+#endif
@@ -0,0 +1,618 @@
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <AzToolsFramework/Script/LuaSymbolsReporterBus.h>
+#include <LuaVSCode/LuaVSCodeBus.h>
+#include <Tools/LuaMetaGenerator.h>
+
+namespace LuaVSCode
+{
+    // Drives Generate() on small snapshots in a temp folder and checks which files it writes, skips and removes
+    class LuaMetaGeneratorTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_metaPath = m_tempDirectory.Resolve("meta");
+        }
+
+        void TearDown() override
+        {
+            // nothing ticks the notification queue in these tests
+            LuaVSCodeNotificationBus::ClearQueuedEvents();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        // eight "Editor" classes and EBuses so sharding keeps an editor shard, the rest goes to misc
+        static LuaMetaSymbols CreateSymbols()
+        {
+            LuaMetaSymbols symbols;
+            const AZStd::string_view number = symbols.m_typeNames.Intern("Number");
+
+            for (int i = 0; i < 9; ++i)
+            {
+                const char* prefix = i < 8 ? "Editor" : "Physics";
+
+                LuaMetaClass& luaClass = symbols.m_classes.emplace_back();
+                luaClass.m_name = AZStd::string::format("%sClass%d", prefix, i);
+                luaClass.m_properties = { "x" };
+                LuaMetaMethod& method = luaClass.m_methods.emplace_back();
+                method.m_name = "GetValue";
+                method.m_hasSignature = true;
+                method.m_parameters.push_back({ number, symbols.m_tooltips.Intern("The index") });
+                method.m_result = number;
+
+                LuaMetaEBus& ebus = symbols.m_ebuses.emplace_back();
+                ebus.m_name = AZStd::string::format("%sRequest%dBus", prefix, i);
+                ebus.m_hasSenders = true;
+                LuaMetaMethod& sender = ebus.m_senders.emplace_back();
+                sender.m_name = "Reset";
+                sender.m_kind = LuaMetaMethodKind::Event;
+                sender.m_hasSignature = true;
+            }
+
+            symbols.m_globalProperties.push_back("g_SettingsRegistry");
+            LuaMetaMethod& globalFunction = symbols.m_globalFunctions.emplace_back();
+            globalFunction.m_name = "Debug";
+            globalFunction.m_debugArgumentInfo = "string";
+            return symbols;
+        }
+
+        // a generator per call, like a launch of the Editor, so the fingerprint is read back from disk
+        AZStd::unique_ptr<LuaMetaGenerator> Generate(LuaMetaSymbols&& symbols, const LuaMetaGeneratorSettings& settings = {})
+        {
+            auto generator = AZStd::make_unique<LuaMetaGenerator>();
+            generator->SetSymbols(AZStd::move(symbols));
+            generator->SetSettings(settings);
+            generator->SetOutputPath(m_metaPath);
+            if (!m_projectPath.empty())
+            {
+                generator->SetProjectPath(m_projectPath);
+            }
+            EXPECT_TRUE(generator->Generate());
+            return generator;
+        }
+
+        static const LuaMetaOutput* FindOutput(const LuaMetaGenerator& generator, AZStd::string_view name)
+        {
+            for (const LuaMetaOutput& output : generator.GetOutputs())
+            {
+                if (output.m_name == name)
+                {
+                    return &output;
+                }
+            }
+            return nullptr;
+        }
+
+        bool Exists(const char* relativePath) const
+        {
+            return AZ::IO::SystemFile::Exists((m_metaPath / relativePath).c_str());
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZ::IO::FixedMaxPath m_metaPath;
+        // no .luarc.json is written unless a test sets it
+        AZ::IO::FixedMaxPath m_projectPath;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    TEST_F(LuaMetaGeneratorTest, Generate_FirstRun_WritesEveryFile)
+    {
+        auto generator = Generate(CreateSymbols());
+
+        ASSERT_EQ(generator->GetOutputs().size(), 4);
+        for (const LuaMetaOutput& output : generator->GetOutputs())
+        {
+            EXPECT_TRUE(output.m_stale) << output.m_name.c_str();
+            EXPECT_TRUE(output.m_written) << output.m_name.c_str();
+            EXPECT_FALSE(output.m_unchanged) << output.m_name.c_str();
+        }
+        EXPECT_TRUE(Exists("library/classes.lua"));
+        EXPECT_TRUE(Exists("library/ebuses.lua"));
+        EXPECT_TRUE(Exists("library/properties.lua"));
+        EXPECT_TRUE(Exists("library/functions.lua"));
+        EXPECT_TRUE(Exists("config.json"));
+        EXPECT_TRUE(Exists("fingerprint.json"));
+        EXPECT_TRUE(Exists("symbols.bin"));
+        EXPECT_FALSE(Exists("index.json"));
+        EXPECT_EQ(generator->GetStats().m_filesWritten, 4);
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_Unchanged_SkipsEveryFile)
+    {
+        Generate(CreateSymbols());
+        auto generator = Generate(CreateSymbols());
+
+        for (const LuaMetaOutput& output : generator->GetOutputs())
+        {
+            EXPECT_FALSE(output.m_stale) << output.m_name.c_str();
+            EXPECT_FALSE(output.m_written) << output.m_name.c_str();
+        }
+        EXPECT_EQ(generator->GetStats().m_filesWritten, 0);
+        EXPECT_EQ(generator->GetStats().m_writeCalls, 0);
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_ChangedClass_RewritesOnlyItsSection)
+    {
+        Generate(CreateSymbols());
+
+        LuaMetaSymbols symbols = CreateSymbols();
+        symbols.m_classes[3].m_properties.push_back("y");
+        auto generator = Generate(AZStd::move(symbols));
+
+        EXPECT_TRUE(FindOutput(*generator, "classes")->m_written);
+        EXPECT_FALSE(FindOutput(*generator, "ebuses")->m_stale);
+        EXPECT_FALSE(FindOutput(*generator, "properties")->m_stale);
+        EXPECT_FALSE(FindOutput(*generator, "functions")->m_stale);
+        EXPECT_EQ(generator->GetStats().m_filesWritten, 1);
+
+        LuaMetaWriter classes;
+        ASSERT_TRUE(classes.ReadFromFile((m_metaPath / "library/classes.lua").c_str()));
+        EXPECT_NE(classes.GetView().find("---@class EditorClass3\n---@field x\n---@field y\n"), AZStd::string_view::npos);
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_MissingFile_Rewritten)
+    {
+        Generate(CreateSymbols());
+        ASSERT_TRUE(AZ::IO::SystemFile::Delete((m_metaPath / "library/functions.lua").c_str()));
+
+        auto generator = Generate(CreateSymbols());
+
+        EXPECT_TRUE(FindOutput(*generator, "functions")->m_written);
+        EXPECT_FALSE(FindOutput(*generator, "classes")->m_stale);
+        EXPECT_TRUE(Exists("library/functions.lua"));
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_NoFingerprint_SameContentLeftUntouched)
+    {
+        Generate(CreateSymbols());
+        ASSERT_TRUE(AZ::IO::SystemFile::Delete((m_metaPath / "fingerprint.json").c_str()));
+
+        auto generator = Generate(CreateSymbols());
+
+        for (const LuaMetaOutput& output : generator->GetOutputs())
+        {
+            EXPECT_TRUE(output.m_stale) << output.m_name.c_str();
+            EXPECT_TRUE(output.m_unchanged) << output.m_name.c_str();
+        }
+        EXPECT_EQ(generator->GetStats().m_filesWritten, 0);
+        EXPECT_EQ(generator->GetStats().m_filesUnchanged, 4);
+        EXPECT_TRUE(Exists("fingerprint.json"));
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_ShardedThenUnsharded_RemovesFilesOfTheOtherLayout)
+    {
+        Generate(CreateSymbols());
+
+        LuaMetaGeneratorSettings sharded;
+        sharded.m_sharded = true;
+        auto generator = Generate(CreateSymbols(), sharded);
+
+        EXPECT_NE(FindOutput(*generator, "classes/editor"), nullptr);
+        EXPECT_NE(FindOutput(*generator, "ebuses/misc"), nullptr);
+        EXPECT_TRUE(Exists("library/classes/editor.lua"));
+        EXPECT_TRUE(Exists("library/classes/misc.lua"));
+        EXPECT_TRUE(Exists("library/ebuses/editor.lua"));
+        EXPECT_TRUE(Exists("index.json"));
+        EXPECT_FALSE(Exists("library/classes.lua"));
+        EXPECT_FALSE(Exists("library/ebuses.lua"));
+
+        Generate(CreateSymbols());
+
+        EXPECT_TRUE(Exists("library/classes.lua"));
+        EXPECT_FALSE(Exists("library/classes/editor.lua"));
+        EXPECT_FALSE(Exists("library/ebuses/misc.lua"));
+        EXPECT_FALSE(Exists("index.json"));
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_EmptiedShard_Removed)
+    {
+        LuaMetaGeneratorSettings sharded;
+        sharded.m_sharded = true;
+        Generate(CreateSymbols(), sharded);
+        ASSERT_TRUE(Exists("library/classes/editor.lua"));
+
+        // below the shard size the editor classes are merged into misc
+        LuaMetaSymbols symbols = CreateSymbols();
+        symbols.m_classes.erase(symbols.m_classes.begin());
+        auto generator = Generate(AZStd::move(symbols), sharded);
+
+        EXPECT_EQ(FindOutput(*generator, "classes/editor"), nullptr);
+        EXPECT_FALSE(Exists("library/classes/editor.lua"));
+        EXPECT_TRUE(Exists("library/classes/misc.lua"));
+        EXPECT_TRUE(Exists("library/ebuses/editor.lua"));
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_GlobalFunctionWithSignature_WritesAnnotations)
+    {
+        LuaMetaSymbols symbols = CreateSymbols();
+        LuaMetaMethod& globalFunction = symbols.m_globalFunctions.emplace_back();
+        globalFunction.m_name = "SetValue";
+        globalFunction.m_hasSignature = true;
+        globalFunction.m_parameters.push_back({ symbols.m_typeNames.Intern("Number"), symbols.m_tooltips.Intern("The index") });
+        globalFunction.m_parameters.push_back({ symbols.m_typeNames.Intern("String"), {} });
+        globalFunction.m_result = symbols.m_typeNames.Intern("Boolean");
+        Generate(AZStd::move(symbols));
+
+        LuaMetaWriter functions;
+        ASSERT_TRUE(functions.ReadFromFile((m_metaPath / "library/functions.lua").c_str()));
+        EXPECT_NE(functions.GetView().find("function Debug(string) end\n"), AZStd::string_view::npos);
+        EXPECT_NE(
+            functions.GetView().find("---@param Number The index\n---@param String\n---@return Boolean\nfunction SetValue(Number, String) end\n"),
+            AZStd::string_view::npos);
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_CachedEntry_RestoredIntoAnotherFolder)
+    {
+        LuaMetaGeneratorSettings settings;
+        settings.m_cachePath = m_tempDirectory.Resolve("cache").c_str();
+        auto publisher = Generate(CreateSymbols(), settings);
+        EXPECT_FALSE(publisher->GetStats().m_restoredFromCache);
+
+        // a second project or branch with the same reflection
+        m_metaPath = m_tempDirectory.Resolve("other/meta");
+        auto generator = Generate(CreateSymbols(), settings);
+
+        EXPECT_TRUE(generator->GetStats().m_restoredFromCache);
+        EXPECT_EQ(generator->GetStats().m_filesWritten, 0);
+        EXPECT_TRUE(Exists("library/classes.lua"));
+        EXPECT_TRUE(Exists("library/functions.lua"));
+        EXPECT_TRUE(Exists("fingerprint.json"));
+
+        LuaMetaWriter published;
+        LuaMetaWriter restored;
+        ASSERT_TRUE(published.ReadFromFile(m_tempDirectory.Resolve("meta/library/classes.lua").c_str()));
+        ASSERT_TRUE(restored.ReadFromFile((m_metaPath / "library/classes.lua").c_str()));
+        EXPECT_EQ(published.GetView(), restored.GetView());
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_CachedEntryOfOtherSymbols_NotRestored)
+    {
+        LuaMetaGeneratorSettings settings;
+        settings.m_cachePath = m_tempDirectory.Resolve("cache").c_str();
+        Generate(CreateSymbols(), settings);
+
+        m_metaPath = m_tempDirectory.Resolve("other/meta");
+        LuaMetaSymbols symbols = CreateSymbols();
+        symbols.m_globalProperties.push_back("g_ProjectSettings");
+        auto generator = Generate(AZStd::move(symbols), settings);
+
+        EXPECT_FALSE(generator->GetStats().m_restoredFromCache);
+        EXPECT_EQ(generator->GetStats().m_filesWritten, 4);
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_NoWorkspaceConfig_Written)
+    {
+        m_projectPath = m_tempDirectory.GetDirectory();
+        Generate(CreateSymbols());
+
+        LuaMetaWriter config;
+        ASSERT_TRUE(config.ReadFromFile((m_projectPath / ".luarc.json").c_str()));
+        EXPECT_NE(config.GetView().find("\"$generator\""), AZStd::string_view::npos);
+        EXPECT_NE(config.GetView().find("\"meta/library\""), AZStd::string_view::npos);
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_GeneratedWorkspaceConfig_Rewritten)
+    {
+        m_projectPath = m_tempDirectory.GetDirectory();
+        LuaMetaWriter previous;
+        previous.Append(R"({ "$generator": "O3DE LuaVSCode", "runtime.version": "Lua 5.1" })");
+        ASSERT_TRUE(previous.WriteToFile((m_projectPath / ".luarc.json").c_str()));
+
+        Generate(CreateSymbols());
+
+        LuaMetaWriter config;
+        ASSERT_TRUE(config.ReadFromFile((m_projectPath / ".luarc.json").c_str()));
+        EXPECT_EQ(config.GetView().find("Lua 5.1"), AZStd::string_view::npos);
+        EXPECT_NE(config.GetView().find("\"meta/library\""), AZStd::string_view::npos);
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_HandWrittenWorkspaceConfig_LeftUntouched)
+    {
+        m_projectPath = m_tempDirectory.GetDirectory();
+        constexpr AZStd::string_view handWritten = R"({ "runtime.version": "Lua 5.1" })";
+        LuaMetaWriter previous;
+        previous.Append(handWritten);
+        ASSERT_TRUE(previous.WriteToFile((m_projectPath / ".luarc.json").c_str()));
+
+        Generate(CreateSymbols());
+
+        LuaMetaWriter config;
+        ASSERT_TRUE(config.ReadFromFile((m_projectPath / ".luarc.json").c_str()));
+        EXPECT_EQ(config.GetView(), handWritten);
+    }
+
+    TEST_F(LuaMetaGeneratorTest, Generate_WorkspaceConfigDisabled_NotWritten)
+    {
+        m_projectPath = m_tempDirectory.GetDirectory();
+        LuaMetaGeneratorSettings settings;
+        settings.m_workspaceConfig = false;
+        Generate(CreateSymbols(), settings);
+
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists((m_projectPath / ".luarc.json").c_str()));
+    }
+
+    struct MetaTestReported
+    {
+        AZ_TYPE_INFO(MetaTestReported, "{6E0B5F2A-3C7D-4B61-9D0E-2F6A8C1B7E54}");
+        AZ_CLASS_ALLOCATOR(MetaTestReported, AZ::SystemAllocator);
+        int GetValue() const { return 0; }
+    };
+
+    struct MetaTestAdded
+    {
+        AZ_TYPE_INFO(MetaTestAdded, "{B3D9A4E1-7F25-4C08-A6B2-5E1C9D3F8A70}");
+        AZ_CLASS_ALLOCATOR(MetaTestAdded, AZ::SystemAllocator);
+        int GetValue() const { return 0; }
+    };
+
+    static int MetaTestGlobal(int value)
+    {
+        return value;
+    }
+
+    // A symbol reporter that lists what the test gives it, like lists built before a module reflected more
+    class TestSymbolsReporter
+        : public AzToolsFramework::Script::LuaSymbolsReporterRequests
+    {
+    public:
+        const AZStd::vector<AzToolsFramework::Script::LuaClassSymbol>& GetListOfClasses() override { return m_classes; }
+        const AZStd::vector<AzToolsFramework::Script::LuaPropertySymbol>& GetListOfGlobalProperties() override { return m_globalProperties; }
+        const AZStd::vector<AzToolsFramework::Script::LuaMethodSymbol>& GetListOfGlobalFunctions() override { return m_globalFunctions; }
+        const AZStd::vector<AzToolsFramework::Script::LuaEBusSymbol>& GetListOfEBuses() override { return m_ebuses; }
+
+        AZStd::vector<AzToolsFramework::Script::LuaClassSymbol> m_classes;
+        AZStd::vector<AzToolsFramework::Script::LuaPropertySymbol> m_globalProperties;
+        AZStd::vector<AzToolsFramework::Script::LuaMethodSymbol> m_globalFunctions;
+        AZStd::vector<AzToolsFramework::Script::LuaEBusSymbol> m_ebuses;
+    };
+
+    // Captures from a BehaviorContext that holds more than the reporter lists
+    class LuaMetaCaptureTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            m_behaviorContext = AZStd::make_unique<AZ::BehaviorContext>();
+            m_behaviorContext->Class<MetaTestReported>("MetaTestReported")
+                ->Method("GetValue", &MetaTestReported::GetValue);
+            m_behaviorContext->Class<MetaTestAdded>("MetaTestAdded")
+                ->Method("GetValue", &MetaTestAdded::GetValue);
+            m_behaviorContext->Method("MetaTestGlobal", &MetaTestGlobal);
+            m_behaviorContext->Method("MetaTestAddedGlobal", &MetaTestGlobal);
+
+            // the reporter built its lists before MetaTestAdded and MetaTestAddedGlobal were reflected
+            AzToolsFramework::Script::LuaClassSymbol& reported = m_reporter.m_classes.emplace_back();
+            reported.m_name = "MetaTestReported";
+            reported.m_typeId = azrtti_typeid<MetaTestReported>();
+            reported.m_methods.emplace_back().m_name = "GetValue";
+            AzToolsFramework::Script::LuaMethodSymbol& globalFunction = m_reporter.m_globalFunctions.emplace_back();
+            globalFunction.m_name = "MetaTestGlobal";
+            globalFunction.m_debugArgumentInfo = "int";
+        }
+
+        void TearDown() override
+        {
+            m_reporter = {};
+            m_behaviorContext.reset();
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        static AZStd::vector<AZStd::string> GetClassNames(const LuaMetaGenerator& generator)
+        {
+            AZStd::vector<AZStd::string> names;
+            for (const LuaMetaClass& luaClass : generator.GetSymbols().m_classes)
+            {
+                names.push_back(luaClass.m_name);
+            }
+            return names;
+        }
+
+        static AZStd::vector<AZStd::string> GetFunctionNames(const LuaMetaGenerator& generator)
+        {
+            AZStd::vector<AZStd::string> names;
+            for (const LuaMetaMethod& globalFunction : generator.GetSymbols().m_globalFunctions)
+            {
+                names.push_back(globalFunction.m_name);
+            }
+            return names;
+        }
+
+        AZStd::unique_ptr<AZ::BehaviorContext> m_behaviorContext;
+        TestSymbolsReporter m_reporter;
+    };
+
+    TEST_F(LuaMetaCaptureTest, CaptureSymbols_NoChanges_OnlyReportedSymbols)
+    {
+        LuaMetaGenerator generator;
+        generator.CaptureSymbols(*m_behaviorContext, m_reporter, {});
+
+        EXPECT_EQ(GetClassNames(generator), AZStd::vector<AZStd::string>({ "MetaTestReported" }));
+        EXPECT_EQ(GetFunctionNames(generator), AZStd::vector<AZStd::string>({ "MetaTestGlobal" }));
+    }
+
+    TEST_F(LuaMetaCaptureTest, CaptureSymbols_AddedSymbols_Captured)
+    {
+        LuaMetaReflectionChanges changes;
+        changes.Add(LuaMetaSection::Classes, "MetaTestAdded");
+        changes.Add(LuaMetaSection::Functions, "MetaTestAddedGlobal");
+        // already listed by the reporter, captured once
+        changes.Add(LuaMetaSection::Classes, "MetaTestReported");
+
+        LuaMetaGenerator generator;
+        generator.CaptureSymbols(*m_behaviorContext, m_reporter, changes);
+
+        EXPECT_EQ(GetClassNames(generator), AZStd::vector<AZStd::string>({ "MetaTestReported", "MetaTestAdded" }));
+        EXPECT_EQ(GetFunctionNames(generator), AZStd::vector<AZStd::string>({ "MetaTestGlobal", "MetaTestAddedGlobal" }));
+
+        const LuaMetaClass& added = generator.GetSymbols().m_classes[1];
+        ASSERT_EQ(added.m_methods.size(), 1);
+        EXPECT_EQ(added.m_methods[0].m_name, "GetValue");
+        EXPECT_TRUE(added.m_methods[0].m_hasSignature);
+
+        const LuaMetaMethod& addedGlobal = generator.GetSymbols().m_globalFunctions[1];
+        EXPECT_TRUE(addedGlobal.m_hasSignature);
+        EXPECT_EQ(addedGlobal.m_parameters.size(), 1);
+    }
+
+    TEST_F(LuaMetaCaptureTest, CaptureSymbols_RemovedSymbols_Dropped)
+    {
+        LuaMetaReflectionChanges changes;
+        changes.Remove(LuaMetaSection::Classes, "MetaTestReported");
+        changes.Remove(LuaMetaSection::Functions, "MetaTestGlobal");
+        changes.Add(LuaMetaSection::Classes, "MetaTestAdded");
+        changes.Remove(LuaMetaSection::Classes, "MetaTestAdded");
+
+        LuaMetaGenerator generator;
+        generator.CaptureSymbols(*m_behaviorContext, m_reporter, changes);
+
+        EXPECT_TRUE(generator.GetSymbols().m_classes.empty());
+        EXPECT_TRUE(generator.GetSymbols().m_globalFunctions.empty());
+
+        // reflected again
+        changes.Add(LuaMetaSection::Classes, "MetaTestReported");
+        generator.CaptureSymbols(*m_behaviorContext, m_reporter, changes);
+        EXPECT_EQ(GetClassNames(generator), AZStd::vector<AZStd::string>({ "MetaTestReported" }));
+    }
+
+    struct MetaTestGameplay
+    {
+        AZ_TYPE_INFO(MetaTestGameplay, "{0C4E7A92-5B1D-4F36-8E2A-D7B3F9615C08}");
+        AZ_CLASS_ALLOCATOR(MetaTestGameplay, AZ::SystemAllocator);
+        int GetValue() const { return 0; }
+    };
+
+    struct MetaTestHidden
+    {
+        AZ_TYPE_INFO(MetaTestHidden, "{9A27C5D3-E816-4B9F-A04D-3C8E1F6B72A5}");
+        AZ_CLASS_ALLOCATOR(MetaTestHidden, AZ::SystemAllocator);
+        int GetValue() const { return 0; }
+    };
+
+    static int s_metaTestGameplayValue = 0;
+
+    // Adds a gem category and symbols excluded from listing to what the reporter lists
+    class LuaMetaFilterTest
+        : public LuaMetaCaptureTest
+    {
+    protected:
+        void SetUp() override
+        {
+            LuaMetaCaptureTest::SetUp();
+
+            m_behaviorContext->Class<MetaTestGameplay>("MetaTestGameplay")
+                ->Attribute(AZ::Script::Attributes::Category, "Gameplay")
+                ->Method("GetValue", &MetaTestGameplay::GetValue)
+                ->Method("GetHiddenValue", &MetaTestGameplay::GetValue)
+                    ->Attribute(AZ::Script::Attributes::ExcludeFrom, AZ::Script::Attributes::ExcludeFlags::List);
+            m_behaviorContext->Class<MetaTestHidden>("MetaTestHidden")
+                ->Attribute(AZ::Script::Attributes::ExcludeFrom, AZ::Script::Attributes::ExcludeFlags::List)
+                ->Method("GetValue", &MetaTestHidden::GetValue);
+            m_behaviorContext->Method("MetaTestHiddenGlobal", &MetaTestGlobal)
+                ->Attribute(AZ::Script::Attributes::ExcludeFrom, AZ::Script::Attributes::ExcludeFlags::List);
+            m_behaviorContext->Method("MetaTestAddedHiddenGlobal", &MetaTestGlobal)
+                ->Attribute(AZ::Script::Attributes::ExcludeFrom, AZ::Script::Attributes::ExcludeFlags::Documentation);
+            m_behaviorContext->Property("g_MetaTestGameplayValue", BehaviorValueProperty(&s_metaTestGameplayValue))
+                ->Attribute(AZ::Script::Attributes::Category, "Gameplay");
+
+            AzToolsFramework::Script::LuaClassSymbol& gameplay = m_reporter.m_classes.emplace_back();
+            gameplay.m_name = "MetaTestGameplay";
+            gameplay.m_typeId = azrtti_typeid<MetaTestGameplay>();
+            gameplay.m_methods.emplace_back().m_name = "GetValue";
+            gameplay.m_methods.emplace_back().m_name = "GetHiddenValue";
+            AzToolsFramework::Script::LuaClassSymbol& hidden = m_reporter.m_classes.emplace_back();
+            hidden.m_name = "MetaTestHidden";
+            hidden.m_typeId = azrtti_typeid<MetaTestHidden>();
+            hidden.m_methods.emplace_back().m_name = "GetValue";
+            m_reporter.m_globalFunctions.emplace_back().m_name = "MetaTestHiddenGlobal";
+            m_reporter.m_globalProperties.emplace_back().m_name = "g_MetaTestGameplayValue";
+
+            m_changes.Add(LuaMetaSection::Functions, "MetaTestAddedHiddenGlobal");
+        }
+
+        AZStd::unique_ptr<LuaMetaGenerator> Capture(const LuaMetaGeneratorSettings& settings)
+        {
+            auto generator = AZStd::make_unique<LuaMetaGenerator>();
+            generator->SetSettings(settings);
+            generator->CaptureSymbols(*m_behaviorContext, m_reporter, m_changes);
+            return generator;
+        }
+
+        LuaMetaReflectionChanges m_changes;
+    };
+
+    TEST_F(LuaMetaFilterTest, CaptureSymbols_FullProfile_CapturesEverything)
+    {
+        auto generator = Capture({});
+
+        EXPECT_EQ(GetClassNames(*generator), AZStd::vector<AZStd::string>({ "MetaTestReported", "MetaTestGameplay", "MetaTestHidden" }));
+        EXPECT_EQ(generator->GetSymbols().m_classes[1].m_methods.size(), 2);
+        EXPECT_EQ(GetFunctionNames(*generator),
+            AZStd::vector<AZStd::string>({ "MetaTestGlobal", "MetaTestHiddenGlobal", "MetaTestAddedHiddenGlobal" }));
+        EXPECT_EQ(generator->GetSymbols().m_globalProperties, AZStd::vector<AZStd::string>({ "g_MetaTestGameplayValue" }));
+    }
+
+    TEST_F(LuaMetaFilterTest, CaptureSymbols_LeanProfile_LeavesOutExcludedFromListing)
+    {
+        LuaMetaGeneratorSettings settings;
+        settings.m_profile = LuaMetaProfile::Lean;
+        auto generator = Capture(settings);
+
+        EXPECT_EQ(GetClassNames(*generator), AZStd::vector<AZStd::string>({ "MetaTestReported", "MetaTestGameplay" }));
+        const LuaMetaClass& gameplay = generator->GetSymbols().m_classes[1];
+        ASSERT_EQ(gameplay.m_methods.size(), 1);
+        EXPECT_EQ(gameplay.m_methods[0].m_name, "GetValue");
+        EXPECT_EQ(GetFunctionNames(*generator), AZStd::vector<AZStd::string>({ "MetaTestGlobal" }));
+        EXPECT_EQ(generator->GetSymbols().m_globalProperties, AZStd::vector<AZStd::string>({ "g_MetaTestGameplayValue" }));
+    }
+
+    TEST_F(LuaMetaFilterTest, CaptureSymbols_IncludeCategory_OnlyThatCategory)
+    {
+        LuaMetaGeneratorSettings settings;
+        settings.m_include = { "Gameplay" };
+        auto generator = Capture(settings);
+
+        EXPECT_EQ(GetClassNames(*generator), AZStd::vector<AZStd::string>({ "MetaTestGameplay" }));
+        EXPECT_TRUE(generator->GetSymbols().m_globalFunctions.empty());
+        EXPECT_EQ(generator->GetSymbols().m_globalProperties, AZStd::vector<AZStd::string>({ "g_MetaTestGameplayValue" }));
+    }
+
+    TEST_F(LuaMetaFilterTest, CaptureSymbols_ExcludePatterns_DropMatchingNames)
+    {
+        LuaMetaGeneratorSettings settings;
+        settings.m_exclude = { "MetaTest*Global", "g_*", "*Hidden" };
+        auto generator = Capture(settings);
+
+        EXPECT_EQ(GetClassNames(*generator), AZStd::vector<AZStd::string>({ "MetaTestReported", "MetaTestGameplay" }));
+        EXPECT_TRUE(generator->GetSymbols().m_globalFunctions.empty());
+        EXPECT_TRUE(generator->GetSymbols().m_globalProperties.empty());
+    }
+} // namespace LuaVSCode
@@ -0,0 +1,127 @@
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+#include <Tools/LuaMetaWriter.h>
+#include <benchmark/benchmark.h>
+
+namespace LuaVSCode
+{
+    // Compares the original one write per generated line against LuaMetaWriter.
+    // The "writes" counter is the number of file write calls issued per generated file.
+    class LuaMetaWriterBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        static constexpr int OpenMode = AZ::IO::SystemFile::OpenMode::SF_OPEN_CREATE |
+            AZ::IO::SystemFile::OpenMode::SF_OPEN_WRITE_ONLY |
+            AZ::IO::SystemFile::OpenMode::SF_OPEN_CREATE_PATH;
+
+        // one class with a few methods, close to the average reflected class
+        static constexpr int LinesPerClass = 12;
+
+        void ReportCounters(benchmark::State& state, size_t writeCount, size_t bytesWritten)
+        {
+            state.counters["writes"] = benchmark::Counter(static_cast<double>(writeCount), benchmark::Counter::kAvgIterations);
+            state.SetBytesProcessed(static_cast<int64_t>(bytesWritten));
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    BENCHMARK_DEFINE_F(LuaMetaWriterBenchmarkFixture, WritePerLine)(benchmark::State& state)
+    {
+        const auto filePath = m_tempDirectory.Resolve("classes.lua");
+        const int classCount = static_cast<int>(state.range(0));
+        size_t writeCount = 0;
+        size_t bytesWritten = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::SystemFile luaMetaFile;
+            luaMetaFile.Open(filePath.c_str(), OpenMode);
+            AZStd::string buffer;
+            for (int classIndex = 0; classIndex < classCount; ++classIndex)
+            {
+                buffer = AZStd::string::format("\n---@class Class%d\n", classIndex);
+                bytesWritten += luaMetaFile.Write(buffer.c_str(), buffer.size());
+                ++writeCount;
+                for (int line = 0; line < LinesPerClass; ++line)
+                {
+                    buffer = AZStd::string::format("---@param argument%d Tooltip for argument %d\n", line, line);
+                    bytesWritten += luaMetaFile.Write(buffer.c_str(), buffer.size());
+                    ++writeCount;
+                }
+            }
+            luaMetaFile.Close();
+        }
+
+        ReportCounters(state, writeCount, bytesWritten);
+    }
+
+    BENCHMARK_DEFINE_F(LuaMetaWriterBenchmarkFixture, LuaMetaWriter)(benchmark::State& state)
+    {
+        const auto filePath = m_tempDirectory.Resolve("classes.lua");
+        const int classCount = static_cast<int>(state.range(0));
+        size_t writeCount = 0;
+        size_t bytesWritten = 0;
+
+        LuaMetaWriter writer;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            writer.Clear();
+            for (int classIndex = 0; classIndex < classCount; ++classIndex)
+            {
+                writer.AppendFormat("\n---@class Class%d\n", classIndex);
+                for (int line = 0; line < LinesPerClass; ++line)
+                {
+                    writer.AppendFormat("---@param argument%d Tooltip for argument %d\n", line, line);
+                }
+            }
+
+            // an identical file would be skipped, remove it so every iteration writes
+            AZ::IO::SystemFile::Delete(filePath.c_str());
+            const size_t writesBefore = writer.GetWriteCount();
+            writer.WriteToFile(filePath.c_str());
+            writeCount += writer.GetWriteCount() - writesBefore;
+            bytesWritten += writer.GetSize();
+        }
+
+        ReportCounters(state, writeCount, bytesWritten);
+    }
+
+    // regenerating without reflection changes, the file already holds the same bytes and is only compared
+    BENCHMARK_DEFINE_F(LuaMetaWriterBenchmarkFixture, LuaMetaWriterUnchanged)(benchmark::State& state)
+    {
+        const auto filePath = m_tempDirectory.Resolve("classes.lua");
+        const int classCount = static_cast<int>(state.range(0));
+
+        LuaMetaWriter writer;
+        for (int classIndex = 0; classIndex < classCount; ++classIndex)
+        {
+            writer.AppendFormat("\n---@class Class%d\n", classIndex);
+            for (int line = 0; line < LinesPerClass; ++line)
+            {
+                writer.AppendFormat("---@param argument%d Tooltip for argument %d\n", line, line);
+            }
+        }
+        writer.WriteToFile(filePath.c_str());
+
+        const size_t writesBefore = writer.GetWriteCount();
+        size_t bytesCompared = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            writer.WriteToFile(filePath.c_str());
+            bytesCompared += writer.GetSize();
+        }
+
+        ReportCounters(state, writer.GetWriteCount() - writesBefore, bytesCompared);
+    }
+
+    BENCHMARK_REGISTER_F(LuaMetaWriterBenchmarkFixture, WritePerLine)->Arg(100)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(LuaMetaWriterBenchmarkFixture, LuaMetaWriter)->Arg(100)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(LuaMetaWriterBenchmarkFixture, LuaMetaWriterUnchanged)->Arg(100)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond);
+} // namespace LuaVSCode
+
+#endif
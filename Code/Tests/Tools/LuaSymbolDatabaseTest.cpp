@@ -0,0 +1,91 @@
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <LuaVSCode/LuaSymbolDatabase.h>
+#include <Tools/LuaSymbolDatabaseWriter.h>
+
+namespace LuaVSCode
+{
+    class LuaSymbolDatabaseTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        static LuaMetaSymbols CreateSymbols()
+        {
+            LuaMetaSymbols symbols;
+
+            LuaMetaClass& vector3 = symbols.m_classes.emplace_back();
+            vector3.m_name = "Vector3";
+            vector3.m_properties = { "x", "y", "z" };
+            LuaMetaMethod& length = vector3.m_methods.emplace_back();
+            length.m_name = "GetLength";
+            length.m_hasSignature = true;
+            length.m_parameters.push_back({ symbols.m_typeNames.Intern("Vector3"), symbols.m_tooltips.Intern("The vector") });
+            length.m_result = symbols.m_typeNames.Intern("Number");
+
+            LuaMetaEBus& ebus = symbols.m_ebuses.emplace_back();
+            ebus.m_name = "TransformBus";
+            ebus.m_hasSenders = true;
+            ebus.m_canBroadcast = false;
+            LuaMetaMethod& getPosition = ebus.m_senders.emplace_back();
+            getPosition.m_name = "GetWorldTranslation";
+            getPosition.m_kind = LuaMetaMethodKind::Event;
+
+            symbols.m_globalProperties.push_back("g_SettingsRegistry");
+            LuaMetaMethod& print = symbols.m_globalFunctions.emplace_back();
+            print.m_name = "Debug";
+            print.m_debugArgumentInfo = "string";
+            return symbols;
+        }
+    };
+
+    TEST_F(LuaSymbolDatabaseTest, Write_ReadBack_FindsEverySymbol)
+    {
+        const LuaMetaSymbols symbols = CreateSymbols();
+        LuaMetaWriter output;
+        LuaSymbolDatabaseWriter writer;
+        writer.Write(symbols, 1234, output);
+
+        SymbolDatabase::LuaSymbolDatabaseView view;
+        ASSERT_TRUE(view.Open(output.GetData(), output.GetSize()));
+        EXPECT_EQ(view.GetFingerprint(), 1234);
+        EXPECT_EQ(view.GetClasses().size(), 1);
+        EXPECT_EQ(view.GetEBuses().size(), 1);
+
+        const SymbolDatabase::Class* vector3 = view.FindClass("Vector3");
+        ASSERT_NE(vector3, nullptr);
+        EXPECT_EQ(view.GetProperties(*vector3).size(), 3);
+        ASSERT_EQ(view.GetMethods(*vector3).size(), 1);
+        const SymbolDatabase::Method& length = view.GetMethods(*vector3)[0];
+        EXPECT_EQ(view.GetString(length.m_name), "GetLength");
+        EXPECT_EQ(view.GetString(length.m_result), "Number");
+        ASSERT_EQ(view.GetParameters(length).size(), 1);
+        EXPECT_EQ(view.GetString(view.GetParameters(length)[0].m_tooltip), "The vector");
+
+        const SymbolDatabase::EBus* ebus = view.FindEBus("TransformBus");
+        ASSERT_NE(ebus, nullptr);
+        ASSERT_EQ(view.GetSenders(*ebus).size(), 1);
+        EXPECT_EQ(view.GetSenders(*ebus)[0].m_kind, SymbolDatabase::MethodKind::Event);
+
+        EXPECT_NE(view.FindGlobalProperty("g_SettingsRegistry"), nullptr);
+        const SymbolDatabase::Method* debug = view.FindGlobalFunction("Debug");
+        ASSERT_NE(debug, nullptr);
+        EXPECT_EQ(view.GetString(debug->m_debugArgumentInfo), "string");
+
+        EXPECT_EQ(view.FindClass("Vector4"), nullptr);
+        EXPECT_EQ(view.FindEBus("Vector3"), nullptr);
+    }
+
+    TEST_F(LuaSymbolDatabaseTest, Open_TruncatedOrWrongMagic_Fails)
+    {
+        LuaMetaWriter output;
+        LuaSymbolDatabaseWriter writer;
+        writer.Write(CreateSymbols(), 0, output);
+
+        SymbolDatabase::LuaSymbolDatabaseView view;
+        EXPECT_FALSE(view.Open(output.GetData(), output.GetSize() - 1));
+
+        AZStd::vector<char> corrupt(output.GetData(), output.GetData() + output.GetSize());
+        corrupt[0] = 'X';
+        EXPECT_FALSE(view.Open(corrupt.data(), corrupt.size()));
+    }
+} // namespace LuaVSCode
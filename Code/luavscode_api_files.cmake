@@ -1,4 +1,5 @@
 
 set(FILES
     Include/LuaVSCode/LuaVSCodeBus.h
+    Include/LuaVSCode/LuaSymbolDatabase.h
 )
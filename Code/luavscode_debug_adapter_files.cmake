@@ -4,5 +4,18 @@ set(FILES
     Source/Tools/DebugAdapter/LUADebugAdapterApplication.cpp
     Source/Tools/DebugAdapter/LUADebuggerComponent.h
     Source/Tools/DebugAdapter/LUADebuggerComponent.cpp
+    Source/Tools/DebugAdapter/LUABoundedQueue.h
+    Source/Tools/DebugAdapter/LUABreakpoints.h
+    Source/Tools/DebugAdapter/LUABreakpoints.cpp
+    Source/Tools/DebugAdapter/LUACallstack.h
+    Source/Tools/DebugAdapter/LUACallstack.cpp
     Source/Tools/DebugAdapter/LUADebuggerBus.h
+    Source/Tools/DebugAdapter/LUAProjectRoots.h
+    Source/Tools/DebugAdapter/LUAProjectRoots.cpp
+    Source/Tools/DebugAdapter/LUARemoteRequests.h
+    Source/Tools/DebugAdapter/LUARemoteRequests.cpp
+    Source/Tools/DebugAdapter/LUARuntimeSymbols.h
+    Source/Tools/DebugAdapter/LUARuntimeSymbols.cpp
+    Source/Tools/DebugAdapter/LUAVariables.h
+    Source/Tools/DebugAdapter/LUAVariables.cpp
 )
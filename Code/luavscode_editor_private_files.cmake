@@ -2,4 +2,13 @@
 set(FILES
     Source/Tools/LuaVSCodeEditorSystemComponent.cpp
     Source/Tools/LuaVSCodeEditorSystemComponent.h
+    Source/Tools/LuaMetaCache.cpp
+    Source/Tools/LuaMetaCache.h
+    Source/Tools/LuaMetaGenerator.cpp
+    Source/Tools/LuaMetaGenerator.h
+    Source/Tools/LuaMetaSymbols.h
+    Source/Tools/LuaMetaWriter.cpp
+    Source/Tools/LuaMetaWriter.h
+    Source/Tools/LuaSymbolDatabaseWriter.cpp
+    Source/Tools/LuaSymbolDatabaseWriter.h
 )
@@ -1,4 +1,22 @@
-
 set(FILES
     Tests/Tools/LuaVSCodeEditorTest.cpp
+    Tests/Tools/LuaMetaWriterBenchmarks.cpp
+    Tests/Tools/LuaMetaGeneratorTest.cpp
+    Tests/Tools/LuaMetaGeneratorBenchmarks.cpp
+    Tests/Tools/LuaSymbolDatabaseTest.cpp
+    Tests/Tools/DebugAdapter/LUABoundedQueueTest.cpp
+    Tests/Tools/DebugAdapter/LUABreakpointTableTest.cpp
+    Tests/Tools/DebugAdapter/LUACallstackTest.cpp
+    Tests/Tools/DebugAdapter/LUARemoteRequestsTest.cpp
+    Tests/Tools/DebugAdapter/LUAVariableStoreTest.cpp
+    # the adapter executable cannot be linked into a test module, its units are built in directly
+    Source/Tools/DebugAdapter/LUABoundedQueue.h
+    Source/Tools/DebugAdapter/LUABreakpoints.h
+    Source/Tools/DebugAdapter/LUABreakpoints.cpp
+    Source/Tools/DebugAdapter/LUACallstack.h
+    Source/Tools/DebugAdapter/LUACallstack.cpp
+    Source/Tools/DebugAdapter/LUARemoteRequests.h
+    Source/Tools/DebugAdapter/LUARemoteRequests.cpp
+    Source/Tools/DebugAdapter/LUAVariables.h
+    Source/Tools/DebugAdapter/LUAVariables.cpp
 )
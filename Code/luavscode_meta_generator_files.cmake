@@ -0,0 +1,5 @@
+set(FILES
+    Source/Tools/MetaGenerator/Main.cpp
+    Source/Tools/MetaGenerator/LuaMetaGeneratorApplication.h
+    Source/Tools/MetaGenerator/LuaMetaGeneratorApplication.cpp
+)